@@ -26,9 +26,9 @@ static void printSuccess(string msg)
 // ============================================================================
 // 3/8 AdminModule (Constructor)
 // ============================================================================
-AdminModule::AdminModule(MYSQL* c)
+AdminModule::AdminModule(DataStore* s)
 {
-    conn = c;
+    store = s;
 }
 
 // ============================================================================
@@ -66,26 +66,14 @@ string AdminModule::login()
     // --------------------------------------------------
     // Authenticate Against Database
     // --------------------------------------------------
-    string query = "SELECT role FROM admins WHERE username='" + u + "' AND password='" + p + "'";
-    
-    // #### Database Query Check ####
-    if (mysql_query(conn, query.c_str()))
-    {
-        return "";
-    }
-
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row = mysql_fetch_row(res);
+    string role;
 
     // #### Validation Check ####
-    if (row)
+    if (store->admins().authenticate(u, p, role) == Lookup::Found)
     {
-        string role = row[0];
-        mysql_free_result(res);
         return role;
     }
 
-    mysql_free_result(res);
     return "";
 }
 
@@ -169,19 +157,24 @@ void AdminModule::addAdmin()
     // --------------------------------------------------
     // Duplicate Check
     // --------------------------------------------------
-    string check = "SELECT id FROM admins WHERE username='" + u + "'";
-    mysql_query(conn, check.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
+    Admin existing;
+    Lookup check = store->admins().findByUsername(u, existing);
+
+    // #### Query Failure Check ####
+    if (check == Lookup::Failed)
+    {
+        cout << "    \033[1;31m[ERROR] " << store->lastError() << "\033[0m\n";
+        system("pause");
+        return;
+    }
     
     // #### Existence Validation ####
-    if (mysql_num_rows(res) > 0)
+    if (check == Lookup::Found)
     {
         cout << "    \033[1;31m[ERROR] Username already taken.\033[0m\n";
-        mysql_free_result(res);
         system("pause");
         return;
     }
-    mysql_free_result(res);
     
     cout << "    Password : ";
     p = Utils::getValidString();
@@ -204,15 +197,15 @@ void AdminModule::addAdmin()
     // --------------------------------------------------
     // Insert Into Database
     // --------------------------------------------------
-    string query = "INSERT INTO admins (username, password, role) VALUES ('" + u + "', '" + p + "', '" + r + "')";
+    Admin account{0, u, p, r};
     
-    if (!mysql_query(conn, query.c_str()))
+    if (store->admins().add(account))
     {
         printSuccess("New User Added");
     }
     else
     {
-        cout << "    \033[1;31m[ERROR] Failed.\033[0m\n";
+        cout << "    \033[1;31m[ERROR] " << store->lastError() << "\033[0m\n";
     }
 
     system("pause");
@@ -226,10 +219,14 @@ void AdminModule::listAdmins()
     // --------------------------------------------------
     // Fetch Admins
     // --------------------------------------------------
-    mysql_query(conn, "SELECT id, username, role FROM admins");
-    
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
+    vector<Admin> admins;
+
+    // #### Query Failure Check ####
+    if (!store->admins().listAll(admins))
+    {
+        cout << "   \033[1;31m[ERROR] " << store->lastError() << "\033[0m\n";
+        return;
+    }
 
     cout << "\n";
     cout << "  ┌────┬────────────────────────────┬──────────────┐\n";
@@ -239,17 +236,15 @@ void AdminModule::listAdmins()
     // --------------------------------------------------
     // Populate Table
     // --------------------------------------------------
-    while ((row = mysql_fetch_row(res)))
+    for (const Admin& a : admins)
     {
         cout << "  │ " 
-             << right << setw(2)  << row[0] << " │ "
-             << left  << setw(26) << row[1] << " │ "
-             << left  << setw(12) << row[2] << " │\n";
+             << right << setw(2)  << a.id << " │ "
+             << left  << setw(26) << a.username << " │ "
+             << left  << setw(12) << a.role << " │\n";
     }
 
     cout << "  └────┴────────────────────────────┴──────────────┘\n";
-
-    mysql_free_result(res);
 }
 
 // ============================================================================
@@ -264,30 +259,21 @@ void AdminModule::deleteAdmin()
     // --------------------------------------------------
     // Verify Existence
     // --------------------------------------------------
-    string check = "SELECT id FROM admins WHERE id=" + to_string(id);
-    mysql_query(conn, check.c_str());
-    
-    MYSQL_RES* res = mysql_store_result(conn);
+    Admin target;
 
     // #### Not Found Check ####
-    if (mysql_num_rows(res) == 0)
+    if (store->admins().find(id, target) != Lookup::Found)
     {
         cout << "   \033[1;31m[ERROR] User ID not found.\033[0m\n";
-        mysql_free_result(res);
         system("pause");
         return;
     }
 
-    mysql_free_result(res);
-
     // --------------------------------------------------
     // Prevent Deleting Last Admin
     // --------------------------------------------------
-    mysql_query(conn, "SELECT COUNT(*) FROM admins");
-    MYSQL_RES* cRes = mysql_store_result(conn);
-    MYSQL_ROW cRow = mysql_fetch_row(cRes);
-    int totalAdmins = atoi(cRow[0]);
-    mysql_free_result(cRes);
+    int totalAdmins = 0;
+    store->admins().count(totalAdmins);
 
     // #### Min Admin Check ####
     if (totalAdmins <= 1)
@@ -309,15 +295,13 @@ void AdminModule::deleteAdmin()
         return;
     }
 
-    string query = "DELETE FROM admins WHERE id=" + to_string(id);
-    
-    if (!mysql_query(conn, query.c_str()))
+    if (store->admins().remove(id))
     {
         printSuccess("User Deleted");
     }
     else
     {
-        cout << "   \033[1;31m[ERROR] Failed.\033[0m\n";
+        cout << "   \033[1;31m[ERROR] " << store->lastError() << "\033[0m\n";
     }
 
     system("pause");
@@ -4,8 +4,10 @@
 #ifndef ADMIN_MODULE_H
 #define ADMIN_MODULE_H
 
+// Internal Headers
+#include "Repository.h" // Storage-engine neutral data access
+
 // External Libraries
-#include <mysql.h>      // MySQL C API for database interaction
 #include <string>       // String manipulation
 #include <iostream>     // Standard I/O
 
@@ -17,7 +19,7 @@ public:
     // ============================================================================
     // Constructor
     // ============================================================================
-    AdminModule(MYSQL* c);
+    AdminModule(DataStore* s);
     
     // ============================================================================
     // Public Operations
@@ -26,7 +28,7 @@ public:
     void manageAdmins();
 
 private:
-    MYSQL* conn; // Internal MySQL connection handler
+    DataStore* store; // Admin accounts live in store->admins()
     
     // ============================================================================
     // Private Helpers
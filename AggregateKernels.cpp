@@ -0,0 +1,351 @@
+// ============================================================================
+// AGGREGATE KERNELS IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "AggregateKernels.h"
+
+// Standard Libraries
+#include <climits>      // Min / max sentinels
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KERNELS_X86 1
+#include <immintrin.h>  // AVX2 intrinsics
+#ifdef _MSC_VER
+#include <intrin.h>     // __cpuid, _xgetbv
+#endif
+#else
+#define KERNELS_X86 0
+#endif
+
+// GCC / Clang compile just these functions for AVX2; MSVC accepts the intrinsics anywhere
+#if defined(__GNUC__) || defined(__clang__)
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+#else
+#define AVX2_FUNCTION
+#endif
+
+using namespace std;
+
+// Rows between carry-outs of the 32-bit lane counters
+static const size_t COUNT_FLUSH_ROWS = (size_t)1 << 28;
+
+// Unsigned compare covers both ends of [fromDay, toDay) at once
+static inline bool passes(uint8_t status, int32_t day, const RowFilter& f)
+{
+    return status == f.status && (uint32_t)day - (uint32_t)f.fromDay < (uint32_t)f.toDay - (uint32_t)f.fromDay;
+}
+
+// ============================================================================
+// 1/3 Scalar Kernels
+// ============================================================================
+static int64_t scalarSum(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f)
+{
+    int64_t total = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (passes(status[i], day[i], f)) total += values[i];
+    }
+    return total;
+}
+
+static size_t scalarCount(const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (passes(status[i], day[i], f)) total++;
+    }
+    return total;
+}
+
+static bool scalarMinMax(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f,
+                         int64_t& lowest, int64_t& highest)
+{
+    int64_t lo = LLONG_MAX;
+    int64_t hi = LLONG_MIN;
+    bool any = false;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!passes(status[i], day[i], f)) continue;
+        if (values[i] < lo) lo = values[i];
+        if (values[i] > hi) hi = values[i];
+        any = true;
+    }
+    lowest = lo;
+    highest = hi;
+    return any;
+}
+
+static void scalarGroupKeys(const uint8_t* status, const int32_t* day, const uint16_t* product, size_t n, const RowFilter& f,
+                            const int32_t* dayGroup, const int32_t* productSlot, int32_t groupWidth, int32_t* keys)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t group = passes(status[i], day[i], f) ? dayGroup[day[i] - f.fromDay] : -1;
+        keys[i] = (group < 0) ? -1 : group * groupWidth + productSlot[product[i]];
+    }
+}
+
+static void scalarGroupSum(const int32_t* keys, const int64_t* cents, const int32_t* quantity, size_t n,
+                           int64_t* centsBy, int64_t* quantityBy, int64_t* countBy)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t k = keys[i];
+        if (k < 0) continue;
+        centsBy[k] += cents[i];
+        quantityBy[k] += quantity[i];
+        countBy[k]++;
+    }
+}
+
+static const KernelSet SCALAR_KERNELS = {"Scalar", scalarSum, scalarCount, scalarMinMax, scalarGroupKeys, scalarGroupSum};
+
+// ============================================================================
+// 2/3 AVX2 Kernels
+// ============================================================================
+#if KERNELS_X86
+
+// All-ones in the 32-bit lanes of the 8 rows at i that pass the filter
+AVX2_FUNCTION static inline __m256i passMask(const uint8_t* status, const int32_t* day, size_t i,
+                                             __m256i code, __m256i from, __m256i spanBiased)
+{
+    const __m256i bias = _mm256_set1_epi32(INT_MIN);
+    __m256i s = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(status + i)));
+    __m256i offset = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(day + i)), from);
+
+    // Signed compare after flipping the top bit = unsigned offset < span
+    __m256i inRange = _mm256_cmpgt_epi32(spanBiased, _mm256_xor_si256(offset, bias));
+    return _mm256_and_si256(_mm256_cmpeq_epi32(s, code), inRange);
+}
+
+// Rows packed per pass of avx2GroupSum (a multiple of 8, so every block's store fits)
+static const size_t PACK_ROWS = 1024;
+
+// For each 8-bit lane mask: the set lanes in ascending order, then the rest, and how many are set
+struct PackTable
+{
+    int32_t order[256][8];
+    uint8_t count[256];
+
+    PackTable()
+    {
+        for (int bits = 0; bits < 256; bits++)
+        {
+            int at = 0;
+            for (int lane = 0; lane < 8; lane++)
+            {
+                if (bits & (1 << lane)) order[bits][at++] = lane;
+            }
+            count[bits] = (uint8_t)at;
+            for (int lane = 0; lane < 8; lane++)
+            {
+                if (!(bits & (1 << lane))) order[bits][at++] = lane;
+            }
+        }
+    }
+};
+
+// Filter constants broadcast once per call
+#define AVX2_FILTER_SETUP(f)                                                              \
+    const __m256i code = _mm256_set1_epi32((f).status);                                   \
+    const __m256i from = _mm256_set1_epi32((f).fromDay);                                  \
+    const __m256i spanBiased = _mm256_set1_epi32((int32_t)(((uint32_t)(f).toDay - (uint32_t)(f).fromDay) ^ 0x80000000u))
+
+AVX2_FUNCTION static int64_t avx2Sum(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f)
+{
+    AVX2_FILTER_SETUP(f);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i mask = passMask(status, day, i, code, from, spanBiased);
+
+        // Widen the eight 32-bit lane masks to two sets of four 64-bit masks
+        __m256i lowMask = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(mask));
+        __m256i highMask = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask, 1));
+        acc0 = _mm256_add_epi64(acc0, _mm256_and_si256(lowMask, _mm256_loadu_si256((const __m256i*)(values + i))));
+        acc1 = _mm256_add_epi64(acc1, _mm256_and_si256(highMask, _mm256_loadu_si256((const __m256i*)(values + i + 4))));
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalarSum(values + i, status + i, day + i, n - i, f);
+}
+
+AVX2_FUNCTION static size_t avx2Count(const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f)
+{
+    AVX2_FILTER_SETUP(f);
+    size_t total = 0;
+    size_t i = 0;
+    while (i + 8 <= n)
+    {
+        // Passing lanes are -1, so subtracting counts them; flushed before a lane can wrap
+        __m256i acc = _mm256_setzero_si256();
+        size_t stop = (n - i > COUNT_FLUSH_ROWS) ? i + COUNT_FLUSH_ROWS : n;
+        for (; i + 8 <= stop; i += 8)
+        {
+            acc = _mm256_sub_epi32(acc, passMask(status, day, i, code, from, spanBiased));
+        }
+
+        alignas(32) uint32_t lanes[8];
+        _mm256_store_si256((__m256i*)lanes, acc);
+        for (uint32_t lane : lanes) total += lane;
+    }
+    return total + scalarCount(status + i, day + i, n - i, f);
+}
+
+AVX2_FUNCTION static bool avx2MinMax(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f,
+                                     int64_t& lowest, int64_t& highest)
+{
+    AVX2_FILTER_SETUP(f);
+    const __m256i top = _mm256_set1_epi64x(LLONG_MAX);
+    const __m256i bottom = _mm256_set1_epi64x(LLONG_MIN);
+    __m256i lo = top;
+    __m256i hi = bottom;
+    __m256i seen = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i mask = passMask(status, day, i, code, from, spanBiased);
+        seen = _mm256_or_si256(seen, mask);
+        for (int half = 0; half < 2; half++)
+        {
+            __m256i m = _mm256_cvtepi32_epi64(half ? _mm256_extracti128_si256(mask, 1) : _mm256_castsi256_si128(mask));
+            __m256i v = _mm256_loadu_si256((const __m256i*)(values + i + 4 * half));
+
+            // No 64-bit min / max before AVX-512: compare, then blend; failing rows become the sentinels
+            __m256i forLow = _mm256_blendv_epi8(top, v, m);
+            __m256i forHigh = _mm256_blendv_epi8(bottom, v, m);
+            lo = _mm256_blendv_epi8(lo, forLow, _mm256_cmpgt_epi64(lo, forLow));
+            hi = _mm256_blendv_epi8(hi, forHigh, _mm256_cmpgt_epi64(forHigh, hi));
+        }
+    }
+
+    alignas(32) int64_t lows[4];
+    alignas(32) int64_t highs[4];
+    _mm256_store_si256((__m256i*)lows, lo);
+    _mm256_store_si256((__m256i*)highs, hi);
+    int64_t tailLow;
+    int64_t tailHigh;
+    bool any = scalarMinMax(values + i, status + i, day + i, n - i, f, tailLow, tailHigh);
+    any = any || !_mm256_testz_si256(seen, seen);
+
+    lowest = tailLow;
+    highest = tailHigh;
+    for (int lane = 0; lane < 4; lane++)
+    {
+        if (lows[lane] < lowest) lowest = lows[lane];
+        if (highs[lane] > highest) highest = highs[lane];
+    }
+    return any;
+}
+
+AVX2_FUNCTION static void avx2GroupKeys(const uint8_t* status, const int32_t* day, const uint16_t* product, size_t n, const RowFilter& f,
+                                        const int32_t* dayGroup, const int32_t* productSlot, int32_t groupWidth, int32_t* keys)
+{
+    AVX2_FILTER_SETUP(f);
+    const __m256i none = _mm256_set1_epi32(-1);
+    const __m256i width = _mm256_set1_epi32(groupWidth);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i mask = passMask(status, day, i, code, from, spanBiased);
+        __m256i offset = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(day + i)), from);
+
+        // Only passing lanes are gathered, so out-of-range days never touch memory
+        __m256i group = _mm256_mask_i32gather_epi32(none, (const int*)dayGroup, offset, mask, 4);
+        __m256i ids = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(product + i)));
+        __m256i slot = _mm256_i32gather_epi32((const int*)productSlot, ids, 4);
+
+        __m256i key = _mm256_add_epi32(_mm256_mullo_epi32(group, width), slot);
+        __m256i grouped = _mm256_cmpgt_epi32(group, none);
+        _mm256_storeu_si256((__m256i*)(keys + i), _mm256_blendv_epi8(none, key, grouped));
+    }
+    scalarGroupKeys(status + i, day + i, product + i, n - i, f, dayGroup, productSlot, groupWidth, keys + i);
+}
+
+AVX2_FUNCTION static void avx2GroupSum(const int32_t* keys, const int64_t* cents, const int32_t* quantity, size_t n,
+                                       int64_t* centsBy, int64_t* quantityBy, int64_t* countBy)
+{
+    // AVX2 has no scatter. Each block of eight packs the positions of its keyed rows to the
+    // front of a buffer (one permute, no branches), then the adds run over the packed rows
+    // only, so a sparse filter costs no mispredicted branch per block or per lane
+    static const PackTable pack;
+    const __m256i none = _mm256_set1_epi32(-1);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    alignas(32) int32_t rows[PACK_ROWS];
+    size_t i = 0;
+    while (i + 8 <= n)
+    {
+        size_t stop = (n - i > PACK_ROWS) ? i + PACK_ROWS : n;
+        size_t packed = 0;
+        size_t start = i;
+        for (; i + 8 <= stop; i += 8)
+        {
+            __m256i k = _mm256_loadu_si256((const __m256i*)(keys + i));
+            int keyed = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(k, none)));
+            __m256i order = _mm256_loadu_si256((const __m256i*)pack.order[keyed]);
+            __m256i at = _mm256_add_epi32(_mm256_permutevar8x32_epi32(lane, order), _mm256_set1_epi32((int32_t)(i - start)));
+            _mm256_storeu_si256((__m256i*)(rows + packed), at);
+            packed += pack.count[keyed];
+        }
+        for (size_t r = 0; r < packed; r++)
+        {
+            size_t row = start + rows[r];
+            int32_t g = keys[row];
+            centsBy[g] += cents[row];
+            quantityBy[g] += quantity[row];
+            countBy[g]++;
+        }
+    }
+    scalarGroupSum(keys + i, cents + i, quantity + i, n - i, centsBy, quantityBy, countBy);
+}
+
+static const KernelSet AVX2_KERNELS = {"AVX2", avx2Sum, avx2Count, avx2MinMax, avx2GroupKeys, avx2GroupSum};
+
+// CPU has AVX2 and the OS saves the 256-bit registers across task switches
+static bool detectAvx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osSaves = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osSaves || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    // Includes the XGETBV check for OS support
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+// ============================================================================
+// 3/3 Selection
+// ============================================================================
+const KernelSet& AggregateKernels::active()
+{
+    static const KernelSet& chosen = avx2() ? *avx2() : SCALAR_KERNELS;
+    return chosen;
+}
+
+const KernelSet& AggregateKernels::scalar()
+{
+    return SCALAR_KERNELS;
+}
+
+const KernelSet* AggregateKernels::avx2()
+{
+#if KERNELS_X86
+    static const bool supported = detectAvx2();
+    return supported ? &AVX2_KERNELS : nullptr;
+#else
+    return nullptr;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+// ============================================================================
+// AGGREGATE KERNELS HEADER
+// ============================================================================
+#ifndef AGGREGATE_KERNELS_H
+#define AGGREGATE_KERNELS_H
+
+// Standard Libraries
+#include <cstdint>      // Column element types
+#include <cstddef>      // size_t
+
+using namespace std;
+
+// ============================================================================
+// RowFilter
+// A row passes when its status code matches and fromDay <= day < toDay.
+// fromDay must not be above toDay.
+// ============================================================================
+struct RowFilter
+{
+    uint8_t status;
+    int32_t fromDay;
+    int32_t toDay;
+};
+
+// ============================================================================
+// KernelSet
+// Filtered aggregations over the snapshot columns (see SalesSnapshot). Every
+// set returns identical results; only the instructions differ.
+// ============================================================================
+struct KernelSet
+{
+    const char* name;
+
+    // Sum / count / lowest and highest value of the passing rows (minMax is false when none pass)
+    int64_t (*sum)(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f);
+    size_t (*count)(const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f);
+    bool (*minMax)(const int64_t* values, const uint8_t* status, const int32_t* day, size_t n, const RowFilter& f,
+                   int64_t& lowest, int64_t& highest);
+
+    // Group key per row: dayGroup[day - fromDay] * groupWidth + productSlot[product], or -1 when the
+    // row fails the filter or its day has no group (dayGroup entry < 0). productSlot must cover every product.
+    void (*groupKeys)(const uint8_t* status, const int32_t* day, const uint16_t* product, size_t n, const RowFilter& f,
+                      const int32_t* dayGroup, const int32_t* productSlot, int32_t groupWidth, int32_t* keys);
+
+    // Adds each keyed row's cents, quantity and 1 into its group's totals; rows keyed -1 are skipped
+    void (*groupSum)(const int32_t* keys, const int64_t* cents, const int32_t* quantity, size_t n,
+                     int64_t* centsBy, int64_t* quantityBy, int64_t* countBy);
+};
+
+// ============================================================================
+// AggregateKernels
+// Picks the widest kernel set this CPU runs: AVX2 (8 rows per step, checked
+// once with CPUID, including OS support for the wide registers) or the
+// portable scalar loops. The AVX2 functions carry their own target attribute,
+// so the rest of the program needs no special compiler flags.
+// ============================================================================
+class AggregateKernels
+{
+public:
+    static const KernelSet& active();
+    static const KernelSet& scalar();
+    static const KernelSet* avx2();     // nullptr when the CPU or OS lacks AVX2
+};
+
+#endif
\ No newline at end of file
@@ -3,52 +3,517 @@
 // ============================================================================
 // Internal Headers
 #include "DatabaseConnection.h"
+#include "StatementCache.h"   // Cached statements are closed with their connection
+#include "QueryMetrics.h"     // Unfinished timings are closed with their connection
 
 // Standard Libraries
 #include <iostream>        // Console output for error logging (cout, cerr)
+#include <iomanip>         // Formatting (setw, setprecision)
 #include <cstdlib>         // Standard library definitions (NULL, types)
+#include <thread>          // Reconnect backoff sleeps
+#include <errmsg.h>        // Client error codes (CR_SERVER_GONE_ERROR, ...)
 
 using namespace std;
 
+// Pool whose slot counters are updated by reconnect()
+static DatabaseConnection* livePool = nullptr;
+
+// ============================================================================
+// 1/15 Handle (Empty Constructor)
+// ============================================================================
+DatabaseConnection::Handle::Handle()
+{
+    pool = nullptr;
+    slot = -1;
+}
+
+// ============================================================================
+// 2/15 Handle (Leased Constructor)
+// ============================================================================
+DatabaseConnection::Handle::Handle(DatabaseConnection* p, int s)
+{
+    pool = p;
+    slot = s;
+}
+
+// ============================================================================
+// 3/15 Handle (Move Constructor / Assignment)
+// ============================================================================
+DatabaseConnection::Handle::Handle(Handle&& other)
+{
+    pool = other.pool;
+    slot = other.slot;
+    other.pool = nullptr;
+    other.slot = -1;
+}
+
+DatabaseConnection::Handle& DatabaseConnection::Handle::operator=(Handle&& other)
+{
+    if (this != &other)
+    {
+        release();
+        pool = other.pool;
+        slot = other.slot;
+        other.pool = nullptr;
+        other.slot = -1;
+    }
+    return *this;
+}
+
 // ============================================================================
-// 1/3 DatabaseConnection (Constructor)
+// 4/15 ~Handle (Destructor)
 // ============================================================================
-DatabaseConnection::DatabaseConnection()
+DatabaseConnection::Handle::~Handle()
+{
+    release();
+}
+
+// ============================================================================
+// 5/15 Handle::get / Handle::release
+// ============================================================================
+MYSQL* DatabaseConnection::Handle::get() const
+{
+    if (!pool)
+    {
+        return nullptr;
+    }
+    return pool->slots[slot].conn;
+}
+
+void DatabaseConnection::Handle::release()
+{
+    // #### Already Returned Check ####
+    if (pool)
+    {
+        pool->giveBack(slot);
+        pool = nullptr;
+        slot = -1;
+    }
+}
+
+// ============================================================================
+// 6/15 DatabaseConnection (Constructor)
+// ============================================================================
+DatabaseConnection::DatabaseConnection(int minConnections, int maxConnections)
 {
     // --------------------------------------------------
-    // Initialize MySQL Handler
+    // Clamp Pool Bounds
     // --------------------------------------------------
-    conn = mysql_init(0);
+    maxSize = (maxConnections < 1) ? 1 : maxConnections;
+    minSize = (minConnections < 0) ? 0 : minConnections;
+    if (minSize > maxSize)
+    {
+        minSize = maxSize;
+    }
+    idlePingSeconds = 60;
+    livePool = this;
+
+    // Slots are allocated up front so leased indices never move; the extra last one is the batch slot
+    slots.resize(maxSize + 1);
+    for (Slot& s : slots)
+    {
+        s.conn = nullptr;
+        s.inUse = false;
+        s.since = chrono::steady_clock::now();
+        s.stats = ConnectionStats{0, 0, 0, 0, 0.0};
+        s.multiStatements = false;
+    }
+    slots[maxSize].multiStatements = true;
 }
 
 // ============================================================================
-// 2/3 ~DatabaseConnection (Destructor)
+// 7/15 ~DatabaseConnection (Destructor)
 // ============================================================================
 DatabaseConnection::~DatabaseConnection()
 {
     // --------------------------------------------------
     // Cleanup Resources
     // --------------------------------------------------
-    if (conn)
+    if (livePool == this)
     {
-        mysql_close(conn);
+        livePool = nullptr;
+    }
+    for (Slot& s : slots)
+    {
+        if (s.conn)
+        {
+            closeConnection(s.conn);
+            s.conn = nullptr;
+        }
     }
 }
 
 // ============================================================================
-// 3/3 connect
+// 8/15 openConnection
 // ============================================================================
-MYSQL* DatabaseConnection::connect()
+MYSQL* DatabaseConnection::openConnection(bool multiStatements)
 {
     // --------------------------------------------------
     // Establish Database Connection
     // --------------------------------------------------
+    // The MYSQL struct is owned here (not by libmysql) so reconnect() can re-open it in place
+    MYSQL* conn = new MYSQL;
+    mysql_init(conn);
+
     // #### Connection Check ####
-    if (!mysql_real_connect(conn, "127.0.0.1", "root", "", "souvenir_system", 3306, NULL, 0))
+    if (!connectHandle(conn, multiStatements))
     {
         // #### Error Logging ####
         cerr << "\033[1;31m   [CRITICAL] DB Connection Failed: " << mysql_error(conn) << "\033[0m" << endl;
+        closeConnection(conn);
         return nullptr;
     }
     return conn;
+}
+
+bool DatabaseConnection::connectHandle(MYSQL* conn, bool multiStatements)
+{
+    // One statement per query, except on the batch connection that QueryBatch runs on
+    unsigned long flags = multiStatements ? CLIENT_MULTI_STATEMENTS : 0;
+    return mysql_real_connect(conn, "127.0.0.1", "root", "", "souvenir_system", 3306, NULL, flags) != nullptr;
+}
+
+void DatabaseConnection::closeConnection(MYSQL* conn)
+{
+    StatementCache::release(conn);
+    QueryExecutor::forget(conn);
+    mysql_close(conn);
+    delete conn;
+}
+
+// ============================================================================
+// 9/15 connect
+// ============================================================================
+bool DatabaseConnection::connect()
+{
+    lock_guard<mutex> guard(poolLock);
+
+    // --------------------------------------------------
+    // Warm Up Minimum Connections
+    // --------------------------------------------------
+    for (int i = 0; i < minSize; i++)
+    {
+        if (!slots[i].conn)
+        {
+            slots[i].conn = openConnection(false);
+            slots[i].since = chrono::steady_clock::now();
+        }
+
+        // #### Startup Failure Check ####
+        if (!slots[i].conn)
+        {
+            return false;
+        }
+    }
+
+    // A pool with no warm connections must still prove the server is reachable
+    if (minSize == 0)
+    {
+        slots[0].conn = openConnection(false);
+        return slots[0].conn != nullptr;
+    }
+    return true;
+}
+
+// ============================================================================
+// 10/15 checkHealth
+// ============================================================================
+bool DatabaseConnection::checkHealth(MYSQL*& conn, ConnectionStats& counts, bool multiStatements)
+{
+    // Runs without poolLock: the caller has reserved the slot, and counts are merged back under the lock
+
+    // --------------------------------------------------
+    // Ping Idle Handle
+    // --------------------------------------------------
+    if (conn)
+    {
+        counts.pings++;
+        if (mysql_ping(conn) == 0)
+        {
+            return true;
+        }
+        counts.pingFailures++;
+        closeConnection(conn);
+        conn = nullptr;
+    }
+
+    // --------------------------------------------------
+    // Replace Dead Socket
+    // --------------------------------------------------
+    conn = openConnection(multiStatements);
+    if (conn)
+    {
+        counts.reconnects++;
+    }
+    return conn != nullptr;
+}
+
+// ============================================================================
+// 11/15 acquire / acquireBatch / tryAcquire / lease
+// ============================================================================
+DatabaseConnection::Handle DatabaseConnection::acquire(int waitSeconds)
+{
+    return lease(0, maxSize, waitSeconds);
+}
+
+DatabaseConnection::Handle DatabaseConnection::acquireBatch(int waitSeconds)
+{
+    return lease(maxSize, maxSize + 1, waitSeconds);
+}
+
+DatabaseConnection::Handle DatabaseConnection::lease(int first, int last, int waitSeconds)
+{
+    unique_lock<mutex> guard(poolLock);
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::seconds(waitSeconds);
+
+    while (true)
+    {
+        // --------------------------------------------------
+        // Prefer An Open Idle Connection, Else Grow Up To The Maximum
+        // --------------------------------------------------
+        int pick = -1;
+        for (int i = first; i < last && pick < 0; i++)
+        {
+            if (!slots[i].inUse && slots[i].conn) pick = i;
+        }
+        for (int i = first; i < last && pick < 0; i++)
+        {
+            if (!slots[i].inUse) pick = i;
+        }
+
+        if (pick >= 0)
+        {
+            Slot& s = slots[pick];
+            chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+            // #### Recently Used Check ####
+            if (s.conn && chrono::duration<double>(now - s.since).count() < idlePingSeconds)
+            {
+                s.inUse = true;
+                s.since = now;
+                s.stats.checkouts++;
+                return Handle(this, pick);
+            }
+
+            // --------------------------------------------------
+            // Reserve The Slot, Then Ping Or Connect Unlocked
+            // --------------------------------------------------
+            s.inUse = true;
+            MYSQL* conn = s.conn;
+            ConnectionStats counts{0, 0, 0, 0, 0.0};
+            guard.unlock();
+            bool healthy = checkHealth(conn, counts, s.multiStatements);
+            guard.lock();
+
+            s.conn = conn;
+            s.since = chrono::steady_clock::now();
+            s.stats.pings += counts.pings;
+            s.stats.pingFailures += counts.pingFailures;
+            s.stats.reconnects += counts.reconnects;
+
+            // #### Server Unreachable Check ####
+            if (!healthy)
+            {
+                // Roll back: the slot is free (and closed) again
+                s.inUse = false;
+                guard.unlock();
+                released.notify_one();
+                return Handle();
+            }
+            s.stats.checkouts++;
+            return Handle(this, pick);
+        }
+
+        // --------------------------------------------------
+        // Pool Exhausted: Wait For A Release
+        // --------------------------------------------------
+        if (released.wait_until(guard, deadline) == cv_status::timeout)
+        {
+            cerr << "\033[1;31m   [CRITICAL] Connection pool exhausted (" << last - first << " in use)\033[0m" << endl;
+            return Handle();
+        }
+    }
+}
+
+DatabaseConnection::Handle DatabaseConnection::tryAcquire()
+{
+    lock_guard<mutex> guard(poolLock);
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+    // Only a recently used open slot: no wait, no ping, no new connection, no console noise
+    for (int i = 0; i < maxSize; i++)
+    {
+        Slot& s = slots[i];
+        if (!s.inUse && s.conn && chrono::duration<double>(now - s.since).count() < idlePingSeconds)
+        {
+            s.inUse = true;
+            s.since = now;
+            s.stats.checkouts++;
+            return Handle(this, i);
+        }
+    }
+    return Handle();
+}
+
+// ============================================================================
+// 12/15 giveBack
+// ============================================================================
+void DatabaseConnection::giveBack(int slot)
+{
+    {
+        lock_guard<mutex> guard(poolLock);
+        Slot& s = slots[slot];
+        chrono::steady_clock::time_point now = chrono::steady_clock::now();
+        s.stats.busySeconds += chrono::duration<double>(now - s.since).count();
+        s.inUse = false;
+        s.since = now;
+    }
+    released.notify_one();
+}
+
+// ============================================================================
+// 13/15 pingIdle
+// ============================================================================
+void DatabaseConnection::pingIdle()
+{
+    unique_lock<mutex> guard(poolLock);
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+    for (int i = 0; i < (int)slots.size(); i++)
+    {
+        Slot& s = slots[i];
+        if (s.inUse || !s.conn)
+        {
+            continue;
+        }
+
+        double idle = chrono::duration<double>(now - s.since).count();
+        if (idle < idlePingSeconds)
+        {
+            continue;
+        }
+
+        // Reserved while the server is contacted, so acquire() passes over it
+        s.inUse = true;
+        MYSQL* conn = s.conn;
+        ConnectionStats counts{0, 0, 0, 0, 0.0};
+        guard.unlock();
+
+        // #### Shrink Check ####
+        // Connections above the warm minimum (the batch slot included) are closed instead of kept alive
+        if (i >= minSize)
+        {
+            closeConnection(conn);
+            conn = nullptr;
+        }
+        else
+        {
+            checkHealth(conn, counts, s.multiStatements);
+        }
+
+        guard.lock();
+        s.conn = conn;
+        s.since = chrono::steady_clock::now();
+        s.stats.pings += counts.pings;
+        s.stats.pingFailures += counts.pingFailures;
+        s.stats.reconnects += counts.reconnects;
+        s.inUse = false;
+    }
+    guard.unlock();
+    released.notify_all();
+}
+
+// ============================================================================
+// 14/15 isConnectionLost / reconnect
+// ============================================================================
+bool DatabaseConnection::isConnectionLost(MYSQL* conn)
+{
+    // Server restarts and wait_timeout both surface as one of these client errors
+    unsigned int err = mysql_errno(conn);
+    return err == CR_SERVER_GONE_ERROR || err == CR_SERVER_LOST ||
+           err == CR_CONNECTION_ERROR || err == CR_CONN_HOST_ERROR;
+}
+
+bool DatabaseConnection::reconnect(MYSQL* conn)
+{
+    // Prepared statements die with the old session
+    StatementCache::release(conn);
+
+    // The batch connection comes back with multi-statement support, the others without
+    bool multiStatements = false;
+    if (livePool)
+    {
+        lock_guard<mutex> guard(livePool->poolLock);
+        for (const Slot& s : livePool->slots)
+        {
+            if (s.conn == conn) multiStatements = s.multiStatements;
+        }
+    }
+
+    // --------------------------------------------------
+    // Re-open In Place With Exponential Backoff
+    // --------------------------------------------------
+    int delayMs = 100;
+    for (int attempt = 1; attempt <= 5; attempt++)
+    {
+        mysql_close(conn);
+        mysql_init(conn);
+        if (connectHandle(conn, multiStatements))
+        {
+            if (livePool)
+            {
+                lock_guard<mutex> guard(livePool->poolLock);
+                for (Slot& s : livePool->slots)
+                {
+                    if (s.conn == conn) s.stats.reconnects++;
+                }
+            }
+            return true;
+        }
+
+        cerr << "\033[1;33m   [WARN] Reconnect attempt " << attempt << " failed: " << mysql_error(conn) << "\033[0m" << endl;
+        this_thread::sleep_for(chrono::milliseconds(delayMs));
+        delayMs *= 2;
+    }
+    return false;
+}
+
+// ============================================================================
+// 15/15 getStats / printStats
+// ============================================================================
+vector<ConnectionStats> DatabaseConnection::getStats()
+{
+    lock_guard<mutex> guard(poolLock);
+    vector<ConnectionStats> out;
+    for (const Slot& s : slots)
+    {
+        out.push_back(s.stats);
+    }
+    return out;
+}
+
+void DatabaseConnection::printStats()
+{
+    lock_guard<mutex> guard(poolLock);
+
+    cout << "\n   [ CONNECTION POOL ] min " << minSize << " / max " << maxSize << "\n";
+    cout << "  ┌──────┬──────────┬───────────┬────────┬────────┬────────────┬────────────┐\n";
+    cout << "  │ SLOT │ STATE    │ CHECKOUTS │ PINGS  │ FAILED │ RECONNECTS │ BUSY (s)   │\n";
+    cout << "  ├──────┼──────────┼───────────┼────────┼────────┼────────────┼────────────┤\n";
+
+    for (int i = 0; i < (int)slots.size(); i++)
+    {
+        const Slot& s = slots[i];
+        string state = s.inUse ? "In Use" : (s.conn ? "Idle" : "Closed");
+
+        cout << "  │ "
+             << right << setw(4) << (s.multiStatements ? string("B") : to_string(i + 1)) << " │ "
+             << left  << setw(8) << state << " │ "
+             << right << setw(9) << s.stats.checkouts << " │ "
+             << right << setw(6) << s.stats.pings << " │ "
+             << right << setw(6) << s.stats.pingFailures << " │ "
+             << right << setw(10) << s.stats.reconnects << " │ "
+             << right << setw(10) << fixed << setprecision(1) << s.stats.busySeconds << " │\n";
+    }
+    cout << "  └──────┴──────────┴───────────┴────────┴────────┴────────────┴────────────┘\n";
 }
\ No newline at end of file
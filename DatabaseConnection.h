@@ -5,24 +5,107 @@
 #define DATABASE_CONNECTION_H
 
 // External Libraries
-#include <mysql.h> // MySQL C API for database interaction
+#include <mysql.h>              // MySQL C API for database interaction
+#include <vector>               // Pool slot storage
+#include <mutex>                // Pool locking
+#include <condition_variable>   // Waiting for a free slot
+#include <chrono>               // Idle / busy time tracking
+
+using namespace std;
+
+// ============================================================================
+// ConnectionStats
+// Per-handle counters, kept for the lifetime of the pool slot.
+// ============================================================================
+struct ConnectionStats
+{
+    unsigned long checkouts;     // Times the handle was leased out
+    unsigned long pings;         // Idle health pings performed
+    unsigned long pingFailures;  // Pings that found a dead socket
+    unsigned long reconnects;    // Times the socket was re-opened
+    double busySeconds;          // Total time spent checked out
+};
 
 class DatabaseConnection
 {
 public:
+    // ============================================================================
+    // Handle (RAII Checkout)
+    // Returns the connection to the pool when it goes out of scope.
+    // ============================================================================
+    class Handle
+    {
+    public:
+        Handle();
+        Handle(Handle&& other);
+        Handle& operator=(Handle&& other);
+        ~Handle();
+
+        MYSQL* get() const;
+        void release();
+
+    private:
+        friend class DatabaseConnection;
+        Handle(DatabaseConnection* p, int s);
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+
+        DatabaseConnection* pool; // Owning pool (nullptr when empty)
+        int slot;                 // Index of the leased slot
+    };
+
     // ============================================================================
     // Constructor / Destructor
     // ============================================================================
-    DatabaseConnection();
+    DatabaseConnection(int minConnections = 2, int maxConnections = 6);
     ~DatabaseConnection();
-    
+
     // ============================================================================
     // Connection Methods
     // ============================================================================
-    MYSQL* connect();
+    bool connect();
+    Handle acquire(int waitSeconds = 10);
+    Handle acquireBatch(int waitSeconds = 10);  // The one connection opened with CLIENT_MULTI_STATEMENTS
+    Handle tryAcquire();        // Open, recently used idle handle or empty; never waits, pings or connects
+    void pingIdle();
+
+    // ============================================================================
+    // Connection Recovery
+    // Handles keep their address across reconnects, so modules holding a
+    // MYSQL* see the restored session without being rebuilt.
+    // ============================================================================
+    static bool isConnectionLost(MYSQL* conn);
+    static bool reconnect(MYSQL* conn);
+
+    // ============================================================================
+    // Statistics
+    // ============================================================================
+    vector<ConnectionStats> getStats();
+    void printStats();
 
 private:
-    MYSQL* conn; // Internal MySQL connection handler
+    struct Slot
+    {
+        MYSQL* conn;                              // Live MySQL handle (nullptr when closed)
+        bool inUse;                               // Currently checked out
+        chrono::steady_clock::time_point since;   // Checkout time, or idle-since time
+        ConnectionStats stats;                    // Per-handle counters
+        bool multiStatements;                     // Batch slot: opened with CLIENT_MULTI_STATEMENTS
+    };
+
+    vector<Slot> slots;           // maxSize ordinary slots then the batch slot, indices stay stable
+    mutex poolLock;               // Guards slots
+    condition_variable released;  // Signalled when a handle comes back
+    int minSize;                  // Connections opened eagerly and kept warm
+    int maxSize;                  // Hard upper bound on open connections
+    int idlePingSeconds;          // Idle time after which a handle is pinged
+
+    static MYSQL* openConnection(bool multiStatements);
+    static bool connectHandle(MYSQL* conn, bool multiStatements);
+    static void closeConnection(MYSQL* conn);
+    static bool checkHealth(MYSQL*& conn, ConnectionStats& counts, bool multiStatements);
+    Handle lease(int first, int last, int waitSeconds);
+    void giveBack(int slot);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+// ============================================================================
+// FORMAT IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "Format.h"
+
+// Standard Libraries
+#include <charconv>    // to_chars
+#include <cstring>     // memcpy
+#include <cmath>       // llround, fabs
+#include <cstdio>      // snprintf (out-of-range money)
+#include <algorithm>   // min
+
+using namespace std;
+
+// One local calendar day [start, end) and its midnight fields
+struct DayCache
+{
+    time_t start;
+    time_t end;
+    tm midnight;
+};
+
+// Per thread, so no lock is needed; refreshed when the current day moves on
+static thread_local DayCache today = {0, 0, {}};
+
+// Reentrant localtime
+static void systemLocalTime(time_t t, tm& out)
+{
+#ifdef _WIN32
+    localtime_s(&out, &t);
+#else
+    localtime_r(&t, &out);
+#endif
+}
+
+// Caches the local day holding now; days with a clock change are left uncached
+static void cacheDayOf(time_t now, DayCache& day)
+{
+    tm fields;
+    systemLocalTime(now, fields);
+
+    tm startOf = fields;
+    startOf.tm_hour = startOf.tm_min = startOf.tm_sec = 0;
+    startOf.tm_isdst = -1;
+    time_t start = mktime(&startOf);
+
+    tm endOf = startOf;
+    endOf.tm_mday += 1;
+    endOf.tm_isdst = -1;
+    time_t end = mktime(&endOf);
+
+    // #### Clock Change Check ####
+    if (end - start != 24 * 3600)
+    {
+        day.start = day.end = 0;
+        return;
+    }
+    day.start = start;
+    day.end = end;
+    day.midnight = startOf;
+}
+
+// Zero-padded to at least width digits
+static char* putPadded(char* p, long long value, int width)
+{
+    char digits[24];
+    int len = (int)(to_chars(digits, digits + sizeof(digits), value).ptr - digits);
+    for (int i = len; i < width; i++)
+    {
+        *p++ = '0';
+    }
+    memcpy(p, digits, len);
+    return p + len;
+}
+
+// ============================================================================
+// 1/4 localTime
+// ============================================================================
+void Format::localTime(time_t t, tm& out)
+{
+    DayCache& day = today;
+    if (t < day.start || t >= day.end)
+    {
+        time_t now = time(0);
+        if (now < day.start || now >= day.end)
+        {
+            cacheDayOf(now, day);
+        }
+
+        // Other days (e.g. delivery estimates) convert directly
+        if (t < day.start || t >= day.end)
+        {
+            systemLocalTime(t, out);
+            return;
+        }
+    }
+
+    // Within the cached day: the date fields are fixed, only the clock moves
+    long seconds = (long)(t - day.start);
+    out = day.midnight;
+    out.tm_hour = (int)(seconds / 3600);
+    out.tm_min = (int)(seconds / 60 % 60);
+    out.tm_sec = (int)(seconds % 60);
+}
+
+// ============================================================================
+// 2/4 Fixed-Buffer Writers
+// ============================================================================
+size_t Format::writeDate(char* out, time_t t)
+{
+    tm f;
+    localTime(t, f);
+    char* p = putPadded(out, 1900 + f.tm_year, 4);
+    *p++ = '-';
+    p = putPadded(p, 1 + f.tm_mon, 2);
+    *p++ = '-';
+    p = putPadded(p, f.tm_mday, 2);
+    *p = '\0';
+    return p - out;
+}
+
+size_t Format::writeStamp(char* out, time_t t)
+{
+    tm f;
+    localTime(t, f);
+    char* p = putPadded(out, 1900 + f.tm_year, 4);
+    *p++ = '-';
+    p = putPadded(p, 1 + f.tm_mon, 2);
+    *p++ = '-';
+    p = putPadded(p, f.tm_mday, 2);
+    *p++ = ' ';
+    p = putPadded(p, f.tm_hour, 2);
+    *p++ = ':';
+    p = putPadded(p, f.tm_min, 2);
+    *p++ = ':';
+    p = putPadded(p, f.tm_sec, 2);
+    *p = '\0';
+    return p - out;
+}
+
+size_t Format::writeMoney(char* out, double value)
+{
+    // #### Range Check ####
+    // Whole cents must fit a 64-bit integer
+    if (!(fabs(value) < 1e15))
+    {
+        int len = snprintf(out, MONEY_MAX + 1, "%.2f", value);
+        return (len < 0) ? 0 : min((size_t)len, (size_t)MONEY_MAX);
+    }
+
+    long long cents = llround(value * 100);
+    char* p = out;
+    if (cents < 0)
+    {
+        *p++ = '-';
+        cents = -cents;
+    }
+    p = putPadded(p, cents / 100, 1);
+    *p++ = '.';
+    p = putPadded(p, cents % 100, 2);
+    *p = '\0';
+    return p - out;
+}
+
+size_t Format::writeSmartId(char* out, size_t cap, const string& prefix, int day, int seq)
+{
+    // #### Capacity Check ####
+    // Prefix, two dashes, DDMMYYYY, up to ten sequence digits and the terminator
+    if (cap < prefix.size() + 21)
+    {
+        if (cap > 0) out[0] = '\0';
+        return 0;
+    }
+
+    // Format Example: FAIX-15022025-001
+    // The day is the sequence counter's date, so the text always names the counter the number came from
+    int y, m, d;
+    civilDate(day, y, m, d);
+    memcpy(out, prefix.data(), prefix.size());
+    char* p = out + prefix.size();
+    *p++ = '-';
+    p = putPadded(p, d, 2);
+    p = putPadded(p, m, 2);
+    p = putPadded(p, y, 4);
+    *p++ = '-';
+    p = putPadded(p, seq, 3);
+    *p = '\0';
+    return p - out;
+}
+
+// ============================================================================
+// 3/4 String Forms
+// ============================================================================
+string Format::date(time_t t)
+{
+    char buf[DATE_LEN + 1];
+    return string(buf, writeDate(buf, t));
+}
+
+string Format::stamp(time_t t)
+{
+    char buf[STAMP_LEN + 1];
+    return string(buf, writeStamp(buf, t));
+}
+
+string Format::money(double value)
+{
+    char buf[MONEY_MAX + 1];
+    return string(buf, writeMoney(buf, value));
+}
+
+string Format::smartId(const string& prefix, int day, int seq)
+{
+    char buf[64];
+    if (prefix.size() + 21 <= sizeof(buf))
+    {
+        return string(buf, writeSmartId(buf, sizeof(buf), prefix, day, seq));
+    }
+    string big(prefix.size() + 21, '\0');
+    big.resize(writeSmartId(&big[0], big.size(), prefix, day, seq));
+    return big;
+}
+
+// ============================================================================
+// 4/4 Day Numbers
+// ============================================================================
+// Counted in 400-year eras starting each March, so leap days fall at the end of an era year
+int Format::dayNumber(int year, int month, int day)
+{
+    int y = year - (month <= 2 ? 1 : 0);
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yearOfEra = y - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void Format::civilDate(int dayNumber, int& year, int& month, int& day)
+{
+    int z = dayNumber + 719468;
+    int era = (z >= 0 ? z : z - 146096) / 146097;
+    int dayOfEra = z - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int mp = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+size_t Format::writeDay(char* out, int dayNumber)
+{
+    int y, m, d;
+    civilDate(dayNumber, y, m, d);
+    char* p = putPadded(out, y, 4);
+    *p++ = '-';
+    p = putPadded(p, m, 2);
+    *p++ = '-';
+    p = putPadded(p, d, 2);
+    *p = '\0';
+    return p - out;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+// ============================================================================
+// FORMAT HEADER
+// ============================================================================
+#ifndef FORMAT_H
+#define FORMAT_H
+
+// Standard Libraries
+#include <string>       // Convenience copies
+#include <ctime>        // time_t, tm
+#include <cstddef>      // size_t
+
+using namespace std;
+
+// ============================================================================
+// Format
+// Date, timestamp, money and smart_id text shared by every module. Writers
+// fill a caller buffer through to_chars with no allocation; the string forms
+// copy that buffer for records that keep the text. Local time is safe to call
+// from any thread: each thread caches its current local day, so times within
+// today are split arithmetically instead of going back to the time zone tables.
+// ============================================================================
+class Format
+{
+public:
+    static const size_t DATE_LEN = 10;     // YYYY-MM-DD
+    static const size_t STAMP_LEN = 19;    // YYYY-MM-DD HH:MM:SS
+    static const size_t MONEY_MAX = 24;    // Largest money text, without the terminator
+
+    // #### Local Time ####
+    static void localTime(time_t t, tm& out);
+
+    // #### Fixed-Buffer Writers ####
+    // Each writes a terminated string and returns its length
+    static size_t writeDate(char* out, time_t t);                     // out: DATE_LEN + 1
+    static size_t writeStamp(char* out, time_t t);                    // out: STAMP_LEN + 1
+    static size_t writeMoney(char* out, double value);                // out: MONEY_MAX + 1, two decimals
+    static size_t writeSmartId(char* out, size_t cap, const string& prefix, int day, int seq);     // PFX-DDMMYYYY-NNN, day: dayNumber
+
+    // #### String Forms ####
+    static string date(time_t t);
+    static string stamp(time_t t);
+    static string money(double value);
+    static string smartId(const string& prefix, int day, int seq);
+
+    // #### Day Numbers ####
+    // Days since 1970-01-01 in the proleptic Gregorian calendar, no time zone involved
+    static int dayNumber(int year, int month, int day);
+    static void civilDate(int dayNumber, int& year, int& month, int& day);
+    static size_t writeDay(char* out, int dayNumber);                 // out: DATE_LEN + 1
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,235 @@
+// ============================================================================
+// IMPORT READER IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "ImportReader.h"
+
+// Standard Libraries
+#include <cctype>      // Case folding and whitespace
+#include <cstdlib>     // strtol for \u escapes
+
+using namespace std;
+
+// Lower-cased, trimmed field name
+static string fieldName(const string& raw)
+{
+    size_t b = raw.find_first_not_of(" \t\r\"");
+    size_t e = raw.find_last_not_of(" \t\r\"");
+    string name = (b == string::npos) ? "" : raw.substr(b, e - b + 1);
+    for (char& c : name) c = (char)tolower((unsigned char)c);
+    return name;
+}
+
+// ============================================================================
+// 1/5 ImportRecord::get
+// ============================================================================
+const string* ImportRecord::get(const string& name) const
+{
+    for (const pair<string, string>& f : fields)
+    {
+        if (f.first == name) return &f.second;
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// 2/5 ImportReader (Constructor) / open / isJson
+// ============================================================================
+ImportReader::ImportReader(const string& p)
+{
+    path = p;
+    size_t dot = p.find_last_of('.');
+    string ext = (dot == string::npos) ? "" : fieldName(p.substr(dot + 1));
+    json = (ext == "jsonl" || ext == "json");
+    lineNo = 0;
+}
+
+bool ImportReader::open()
+{
+    in.open(path);
+    if (!in)
+    {
+        return false;
+    }
+
+    // #### CSV Header ####
+    if (!json)
+    {
+        string header;
+        if (!getline(in, header))
+        {
+            return false;
+        }
+        lineNo = 1;
+
+        // Skip a UTF-8 byte order mark left by spreadsheet exports
+        if (header.compare(0, 3, "\xEF\xBB\xBF") == 0) header.erase(0, 3);
+        splitCsv(header, columns);
+        for (string& c : columns) c = fieldName(c);
+    }
+    return true;
+}
+
+bool ImportReader::isJson() const
+{
+    return json;
+}
+
+// ============================================================================
+// 3/5 next
+// ============================================================================
+bool ImportReader::next(ImportRecord& rec)
+{
+    string line;
+    while (getline(in, line))
+    {
+        lineNo++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        // Blank lines are not records
+        if (line.find_first_not_of(" \t") == string::npos)
+        {
+            continue;
+        }
+
+        rec.line = lineNo;
+        rec.fields.clear();
+        rec.problem.clear();
+
+        if (json)
+        {
+            parseJson(line, rec.fields, rec.problem);
+            return true;
+        }
+
+        vector<string> values;
+        if (!splitCsv(line, values))
+        {
+            rec.problem = "Unterminated quoted field";
+            return true;
+        }
+        if (values.size() > columns.size())
+        {
+            rec.problem = "More values than header columns";
+            return true;
+        }
+        rec.fields.reserve(values.size());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            rec.fields.push_back(make_pair(columns[i], values[i]));
+        }
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// 4/5 splitCsv
+// ============================================================================
+bool ImportReader::splitCsv(const string& line, vector<string>& out)
+{
+    out.clear();
+    string field;
+    bool quoted = false;
+
+    for (size_t i = 0; i < line.length(); i++)
+    {
+        char c = line[i];
+        if (quoted)
+        {
+            if (c == '"' && i + 1 < line.length() && line[i + 1] == '"') { field += '"'; i++; }
+            else if (c == '"') quoted = false;
+            else field += c;
+        }
+        else if (c == '"') quoted = true;
+        else if (c == ',') { out.push_back(field); field.clear(); }
+        else field += c;
+    }
+    out.push_back(field);
+    return !quoted;
+}
+
+// ============================================================================
+// 5/5 parseJson
+// Flat objects only: string, number, true / false / null values.
+// ============================================================================
+bool ImportReader::parseJson(const string& line, vector<pair<string, string>>& out, string& problem)
+{
+    size_t i = 0;
+    auto skipSpace = [&]() { while (i < line.length() && isspace((unsigned char)line[i])) i++; };
+
+    // Reads a "..." string at i, decoding escapes (\uXXXX as UTF-8)
+    auto readString = [&](string& s) -> bool
+    {
+        if (i >= line.length() || line[i] != '"') return false;
+        for (i++; i < line.length(); i++)
+        {
+            char c = line[i];
+            if (c == '"') { i++; return true; }
+            if (c != '\\') { s += c; continue; }
+            if (++i >= line.length()) return false;
+            switch (line[i])
+            {
+                case 'n': s += '\n'; break;
+                case 't': s += '\t'; break;
+                case 'r': s += '\r'; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'u':
+                {
+                    if (i + 4 >= line.length()) return false;
+                    unsigned long cp = strtoul(line.substr(i + 1, 4).c_str(), nullptr, 16);
+                    i += 4;
+                    if (cp < 0x80) s += (char)cp;
+                    else if (cp < 0x800) { s += (char)(0xC0 | (cp >> 6)); s += (char)(0x80 | (cp & 0x3F)); }
+                    else { s += (char)(0xE0 | (cp >> 12)); s += (char)(0x80 | ((cp >> 6) & 0x3F)); s += (char)(0x80 | (cp & 0x3F)); }
+                    break;
+                }
+                default: s += line[i]; // \" \\ \/
+            }
+        }
+        return false;
+    };
+
+    skipSpace();
+    if (i >= line.length() || line[i] != '{') { problem = "Line is not a JSON object"; return false; }
+    i++;
+    skipSpace();
+    if (i < line.length() && line[i] == '}') return true;
+
+    while (i < line.length())
+    {
+        string name, value;
+        skipSpace();
+        if (!readString(name)) { problem = "Bad field name"; break; }
+        skipSpace();
+        if (i >= line.length() || line[i] != ':') { problem = "Missing ':' after \"" + name + "\""; break; }
+        i++;
+        skipSpace();
+
+        if (i < line.length() && line[i] == '"')
+        {
+            if (!readString(value)) { problem = "Unterminated string for \"" + name + "\""; break; }
+        }
+        else
+        {
+            // Bare number or literal up to the next separator
+            size_t start = i;
+            while (i < line.length() && line[i] != ',' && line[i] != '}' && !isspace((unsigned char)line[i])) i++;
+            value = line.substr(start, i - start);
+            if (value.empty() || value[0] == '{' || value[0] == '[') { problem = "Unsupported value for \"" + name + "\""; break; }
+            if (value == "null") value.clear();
+        }
+        out.push_back(make_pair(fieldName(name), value));
+
+        skipSpace();
+        if (i < line.length() && line[i] == ',') { i++; continue; }
+        if (i < line.length() && line[i] == '}') return true;
+        problem = "Expected ',' or '}'";
+        break;
+    }
+
+    if (problem.empty()) problem = "Unterminated JSON object";
+    out.clear();
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+// ============================================================================
+// IMPORT READER HEADER
+// ============================================================================
+#ifndef IMPORT_READER_H
+#define IMPORT_READER_H
+
+// Standard Libraries
+#include <string>       // Field names and values
+#include <vector>       // Record fields
+#include <utility>      // Name / value pairs
+#include <fstream>      // Source file
+
+using namespace std;
+
+// ============================================================================
+// ImportRecord
+// One input line as name / value pairs. Names are lower-cased; a line that
+// could not be parsed carries the reason in problem and no fields.
+// ============================================================================
+struct ImportRecord
+{
+    int line;                              // 1-based line in the file
+    vector<pair<string, string>> fields;
+    string problem;
+
+    const string* get(const string& name) const;
+};
+
+// ============================================================================
+// ImportReader
+// Streams records from a CSV file (first line names the columns; quoted
+// fields with "" escapes) or a JSONL file (one flat JSON object per line).
+// The format follows the extension: .jsonl / .json, anything else is CSV.
+// ============================================================================
+class ImportReader
+{
+public:
+    ImportReader(const string& path);
+
+    bool open();
+    bool next(ImportRecord& rec);
+    bool isJson() const;
+
+private:
+    ifstream in;
+    string path;
+    bool json;               // JSONL rather than CSV
+    int lineNo;              // Lines consumed so far
+    vector<string> columns;  // CSV header names
+
+    static bool splitCsv(const string& line, vector<string>& out);
+    static bool parseJson(const string& line, vector<pair<string, string>>& out, string& problem);
+};
+
+#endif
\ No newline at end of file
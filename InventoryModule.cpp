@@ -12,11 +12,14 @@
 #include <limits>      // Numeric limits for validation
 #include <ctime>       // Time functions for timestamps
 #include "Utils.h"     // Shared Utility Functions
+#include "ProductCatalog.h" // Cached product catalog
+#include "ProductionScheduler.h" // Workshop backlog and capacity
+#include "Format.h"           // Timestamp and money text
 
 using namespace std;
 
 // ============================================================================
-// 2/10 printSuccess
+// 2/11 printSuccess
 // ============================================================================
 static void printSuccess(string msg)
 {
@@ -26,7 +29,7 @@ static void printSuccess(string msg)
 }
 
 // ============================================================================
-// 3/10 printError
+// 3/11 printError
 // ============================================================================
 static void printError(string msg)
 {
@@ -34,15 +37,15 @@ static void printError(string msg)
 }
 
 // ============================================================================
-// 4/10 InventoryModule (Constructor)
+// 4/11 InventoryModule (Constructor)
 // ============================================================================
-InventoryModule::InventoryModule(MYSQL* c)
+InventoryModule::InventoryModule(DataStore* s)
 {
-    conn = c;
+    store = s;
 }
 
 // ============================================================================
-// 5/10 manageInventory
+// 5/11 manageInventory
 // ============================================================================
 void InventoryModule::manageInventory()
 {
@@ -69,11 +72,12 @@ void InventoryModule::manageInventory()
         cout << "    2) Edit / Update Product\n";
         cout << "    3) Delete Product\n";
         cout << "    4) Search Product\n";
+        cout << "    5) Production Schedule\n";
         cout << "\n";
         cout << "    0) Back to Main Menu\n";
         cout << "  ────────────────────────────────────────────────────────\n";
         cout << "   Choice ➜ ";
-        choice = Utils::getValidRange(0, 4);
+        choice = Utils::getValidRange(0, 5);
 
         // --------------------------------------------------
         // Process Selection
@@ -92,6 +96,9 @@ void InventoryModule::manageInventory()
             case 4: 
                 searchProduct(); 
                 break;
+            case 5: 
+                productionSchedule(); 
+                break;
             case 0: 
                 break;
             default: 
@@ -102,35 +109,34 @@ void InventoryModule::manageInventory()
 }
 
 // ============================================================================
-// 6/10 viewProducts
+// 6/11 viewProducts
 // ============================================================================
 void InventoryModule::viewProducts()
 {
     // --------------------------------------------------
     // Fetch Products
     // --------------------------------------------------
-    if (mysql_query(conn, "SELECT * FROM products"))
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+
+    // #### Query Failure Check ####
+    if (!catalog)
     {
-        printError(mysql_error(conn)); 
+        printError(store->lastError());
         return;
     }
+    const vector<Product>& products = catalog->products;
+    int total = (int)products.size();
 
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
-    int total = mysql_num_rows(res);
-
-    time_t now = time(0);
-    tm* ltm = localtime(&now);
+    char updated[Format::STAMP_LEN + 1];
+    Format::writeStamp(updated, time(0));
 
     // --------------------------------------------------
     // Display Header Stats
     // --------------------------------------------------
     cout << "\n";
     cout << "   TOTAL PRODUCTS : " << total << "\n";
-    cout << "   LAST UPDATED   : " << 1900 + ltm->tm_year << "-" 
-         << setfill('0') << setw(2) << 1 + ltm->tm_mon << "-" 
-         << setw(2) << ltm->tm_mday
-         << " " << setw(2) << ltm->tm_hour << ":" << setw(2) << ltm->tm_min << "\n";
+    cout << "   LAST UPDATED   : ";
+    cout.write(updated, 16) << "\n";   // To the minute
 
     cout << "\n";
     cout << "  ┌─────┬────────────────────┬──────────────┬────────────┬─────────────┬────────┐\n";
@@ -140,22 +146,20 @@ void InventoryModule::viewProducts()
     // --------------------------------------------------
     // Populate List
     // --------------------------------------------------
-    while ((row = mysql_fetch_row(res)))
+    for (const Product& p : products)
     {
-        int idNum = atoi(row[0]);
-        int stock = atoi(row[4]);
-        string type = row[2];
-        string priceStr = "RM " + string(row[3]); 
+        string price = Utils::formatMoney(p.price);
 
+        // Right-align "RM <price>" in 10 columns
         cout << "  │ " 
-             << right << setfill('0') << setw(3) << idNum << setfill(' ') << " │ "
-             << left  << setw(18) << row[1] << " │ "
-             << left  << setw(12) << row[2] << " │ "
-             << right << setw(10) << priceStr << " │ "
-             << right << setw(9) << stock;
+             << right << setfill('0') << setw(3) << p.id << setfill(' ') << " │ "
+             << left  << setw(18) << p.name << " │ "
+             << left  << setw(12) << p.type << " │ "
+             << right << setw(10 - (int)price.size()) << "RM " << price << " │ "
+             << right << setw(9) << p.stock;
 
         // #### Low Stock Warning Check ####
-        if (type == "Ready Stock" && stock < 10)
+        if (p.type == "Ready Stock" && p.stock < 10)
         {
             cout << " \033[1;31m!\033[0m "; 
         }
@@ -164,7 +168,7 @@ void InventoryModule::viewProducts()
             cout << "   "; 
         }
 
-        cout << "│ " << right << setw(6) << row[5] << " │\n";
+        cout << "│ " << right << setw(6) << p.productionHours << " │\n";
     }
 
     cout << "  └─────┴────────────────────┴──────────────┴────────────┴─────────────┴────────┘\n";
@@ -177,12 +181,10 @@ void InventoryModule::viewProducts()
     cout << "   │ The time it takes to manufacture ONE quantity of that custom item.    │\n";
     cout << "   └───────────────────────────────────────────────────────────────────────┘\n";
     cout << "    \033[1;31m(!) = Low Stock Warning (< 10 units)\033[0m\n"; 
-
-    mysql_free_result(res);
 }
 
 // ============================================================================
-// 7/10 addProduct
+// 7/11 addProduct
 // ============================================================================
 void InventoryModule::addProduct()
 {
@@ -278,22 +280,23 @@ void InventoryModule::addProduct()
     // --------------------------------------------------
     // Database Insertion
     // --------------------------------------------------
-    string query = "INSERT INTO products (name, type, price, stock_quantity, production_hours) VALUES ('" + name + "', '" + type + "', " + to_string(price) + ", " + to_string(stock) + ", " + to_string(hours) + ")";
+    Product product{0, name, type, price, stock, hours};
 
-    if (!mysql_query(conn, query.c_str()))
+    if (store->products().add(product))
     {
+        ProductCatalog::bump();
         printSuccess("Product Added Successfully");
     }
     else
     {
-        printError(mysql_error(conn));
+        printError(store->lastError());
     }
 
     system("pause");
 }
 
 // ============================================================================
-// 8/10 editProduct
+// 8/11 editProduct
 // ============================================================================
 void InventoryModule::editProduct()
 {
@@ -315,31 +318,27 @@ void InventoryModule::editProduct()
     // --------------------------------------------------
     // Check Existence
     // --------------------------------------------------
-    string checkSql = "SELECT name, type, price, stock_quantity, production_hours FROM products WHERE id=" + to_string(id);
+    Product product;
+    Lookup found = store->products().find(id, product);
     
-    if (mysql_query(conn, checkSql.c_str())) 
+    if (found == Lookup::Failed) 
     {
+        printError(store->lastError());
+        system("pause");
         return;
     }
 
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row = mysql_fetch_row(res);
-
     // #### Not Found Check ####
-    if (!row)
+    if (found == Lookup::Missing)
     {
         printError("Product ID not found!");
-        mysql_free_result(res);
         system("pause");
         return;
     }
 
-    string currentName = row[0];
-    string currentType = row[1];
-    string currentPrice = row[2];
-    string currentStock = row[3];
-    string currentHours = row[4];
-    mysql_free_result(res);
+    string currentName = product.name;
+    string currentType = product.type;
+    int currentHours = product.productionHours;
 
     // --------------------------------------------------
     // Display Current Info
@@ -348,15 +347,15 @@ void InventoryModule::editProduct()
     cout << "   ──────────────────────────────────────────\n";
     cout << "    Name       : " << currentName << "\n";
     cout << "    Type       : " << currentType << "\n";
-    cout << "    Price      : RM " << currentPrice << "\n";
+    cout << "    Price      : RM " << Utils::formatMoney(product.price) << "\n";
     
     if (currentType == "Ready Stock") 
     {
-         cout << "    Stock      : " << currentStock << "\n";
+         cout << "    Stock      : " << product.stock << "\n";
     }
     else
     {
-         cout << "    Prod.Hours : " << currentHours << "\n";
+         cout << "    Prod.Hours : " << product.productionHours << "\n";
     }
     cout << "   ──────────────────────────────────────────\n";
 
@@ -390,8 +389,6 @@ void InventoryModule::editProduct()
         return;
     }
 
-    string updateQuery = "";
-    
     if (editChoice == 1) 
     {
         // WARNING: Changing product name affects historical reports
@@ -407,24 +404,25 @@ void InventoryModule::editProduct()
         string newName;
         cout << "   Enter New Name ➜ "; 
         newName = Utils::getValidString();
-        updateQuery = "UPDATE products SET name='" + newName + "' WHERE id=" + to_string(id);
+        product.name = newName;
     }
     else if (editChoice == 2) 
     {
         cout << "   Select New Type:\n   1. Ready Stock\n   2. Custom\n   ➜ ";
         int t = Utils::getValidInt();
         string newType = (t == 1) ? "Ready Stock" : "Custom";
+        product.type = newType;
         
         // Reset specific fields when switching type
         if (newType == "Ready Stock")
         {
              // Reset hours to 0 if becoming Ready Stock
-             updateQuery = "UPDATE products SET type='Ready Stock', production_hours=0 WHERE id=" + to_string(id);
+             product.productionHours = 0;
         }
         else
         {
              // Reset stock to 0 if becoming Custom
-             updateQuery = "UPDATE products SET type='Custom', stock_quantity=0 WHERE id=" + to_string(id);
+             product.stock = 0;
         }
     }
     else if (editChoice == 3) 
@@ -439,7 +437,7 @@ void InventoryModule::editProduct()
             system("pause"); 
             return; 
         }
-        updateQuery = "UPDATE products SET price=" + to_string(newPrice) + " WHERE id=" + to_string(id);
+        product.price = newPrice;
     }
     else if (editChoice == 4) 
     {
@@ -456,7 +454,7 @@ void InventoryModule::editProduct()
                 system("pause"); 
                 return; 
             }
-            updateQuery = "UPDATE products SET stock_quantity=" + to_string(newStock) + " WHERE id=" + to_string(id);
+            product.stock = newStock;
         }
         else
         {
@@ -471,27 +469,33 @@ void InventoryModule::editProduct()
                 system("pause"); 
                 return; 
             }
-            updateQuery = "UPDATE products SET production_hours=" + to_string(newHours) + " WHERE id=" + to_string(id);
+            product.productionHours = newHours;
         }
     }
 
     // --------------------------------------------------
     // Perform Update
     // --------------------------------------------------
-    if (!mysql_query(conn, updateQuery.c_str()))
+    if (store->products().update(product))
     {
+        ProductCatalog::bump();
+        if (product.productionHours != currentHours)
+        {
+            // Queued orders of this product now take longer (or shorter) in the workshop
+            ProductionScheduler::productHoursChanged(product.id, product.productionHours);
+        }
         printSuccess("Product Updated Successfully");
     }
     else
     {
-        printError("Update Failed.");
+        printError("Update Failed. " + store->lastError());
     }
 
     system("pause");
 }
 
 // ============================================================================
-// 9/10 deleteProduct
+// 9/11 deleteProduct
 // ============================================================================
 void InventoryModule::deleteProduct()
 {
@@ -512,18 +516,15 @@ void InventoryModule::deleteProduct()
     // --------------------------------------------------
     // Check Dependencies
     // --------------------------------------------------
-    string checkQ = "SELECT COUNT(*) FROM orders WHERE product_id=" + to_string(id);
+    int orderCount = 0;
     
-    if (mysql_query(conn, checkQ.c_str())) 
+    if (!store->orders().countByProduct(id, orderCount)) 
     {
+        printError(store->lastError());
+        system("pause");
         return;
     }
 
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row = mysql_fetch_row(res);
-    int orderCount = atoi(row[0]);
-    mysql_free_result(res);
-
     // #### Linked Order Check ####
     if (orderCount > 0)
     {
@@ -544,22 +545,21 @@ void InventoryModule::deleteProduct()
     // --------------------------------------------------
     // Execute Deletion
     // --------------------------------------------------
-    string query = "DELETE FROM products WHERE id=" + to_string(id);
-    
-    if (!mysql_query(conn, query.c_str()))
+    if (store->products().remove(id))
     {
+        ProductCatalog::bump();
         printSuccess("Product Deleted");
     }
     else
     {
-        printError(mysql_error(conn));
+        printError(store->lastError());
     }
 
     system("pause");
 }
 
 // ============================================================================
-// 10/10 searchProduct
+// 10/11 searchProduct
 // ============================================================================
 void InventoryModule::searchProduct()
 {
@@ -574,31 +574,29 @@ void InventoryModule::searchProduct()
     // --------------------------------------------------
     // Fuzzy Search Query
     // --------------------------------------------------
-    string query = "SELECT * FROM products WHERE name LIKE '%" + keyword + "%'";
+    vector<Product> matches;
     
-    if (mysql_query(conn, query.c_str())) 
+    if (!store->products().searchByName(keyword, matches)) 
     {
+        printError(store->lastError());
+        system("pause");
         return;
     }
 
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
-
     cout << "\n   [ SEARCH RESULTS ]\n";
     cout << "  ┌─────┬────────────────────┬────────────┬──────────┐\n";
     cout << "  │ ID  │ PRODUCT NAME       │ PRICE      │ STOCK    │\n";
     cout << "  ├─────┼────────────────────┼────────────┼──────────┤\n";
 
     bool found = false;
-    while ((row = mysql_fetch_row(res)))
+    for (const Product& p : matches)
     {
         found = true;
-        int idNum = atoi(row[0]);
         cout << "  │ " 
-             << right << setfill('0') << setw(3) << idNum << setfill(' ') << " │ "
-             << left  << setw(18) << row[1] << " │ RM " 
-             << left  << setw(7) << row[3] << " │ " 
-             << left  << setw(8) << row[4] << " │\n";
+             << right << setfill('0') << setw(3) << p.id << setfill(' ') << " │ "
+             << left  << setw(18) << p.name << " │ RM " 
+             << left  << setw(7) << Utils::formatMoney(p.price) << " │ " 
+             << left  << setw(8) << p.stock << " │\n";
     }
 
     cout << "  └─────┴────────────────────┴────────────┴──────────┘\n";
@@ -609,6 +607,85 @@ void InventoryModule::searchProduct()
         cout << "   \033[1;31mNo products found.\033[0m\n";
     }
 
-    mysql_free_result(res);
     system("pause");
+}
+// ============================================================================
+// 11/11 productionSchedule
+// ============================================================================
+void InventoryModule::productionSchedule()
+{
+    int choice;
+    do
+    {
+        // --------------------------------------------------
+        // Load Backlog
+        // --------------------------------------------------
+        shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+
+        // #### Query Failure Check ####
+        if (!catalog || !ProductionScheduler::refresh(*store))
+        {
+            printError(store->lastError());
+            system("pause");
+            return;
+        }
+
+        system("cls");
+        cout << "\n";
+        cout << "  ╔══════════════════════════════════════════════════════╗\n";
+        cout << "  ║                 PRODUCTION SCHEDULE                  ║\n";
+        cout << "  ╚══════════════════════════════════════════════════════╝\n";
+
+        double queued = ProductionScheduler::hoursAhead();
+        int perDay = ProductionScheduler::dailyHours();
+        cout << "\n";
+        cout << "   WORKSHOP HOURS : " << perDay << " h/day\n";
+        cout << "   QUEUED ORDERS  : " << ProductionScheduler::size() << "\n";
+        cout << "   QUEUED WORK    : " << fixed << setprecision(0) << queued << " h ("
+             << setprecision(1) << queued / perDay << " days)\n";
+
+        // --------------------------------------------------
+        // Next Slots
+        // --------------------------------------------------
+        vector<ScheduledJob> next = ProductionScheduler::plan(15);
+        cout << "\n";
+        cout << "  ┌──────────────────┬────────────────────┬──────┬────────┬──────────────────┬────────────┐\n";
+        cout << "  │ ORDER ID         │ PRODUCT            │ QTY  │ HOURS  │ STATUS           │ DONE BY    │\n";
+        cout << "  ├──────────────────┼────────────────────┼──────┼────────┼──────────────────┼────────────┤\n";
+        for (const ScheduledJob& j : next)
+        {
+            const Product* p = catalog->find(j.productId);
+            char done[Format::DATE_LEN + 1];
+            Format::writeDate(done, j.finish);
+            cout << "  │ " << left << setw(16) << j.smartId << " │ "
+                 << setw(18) << (p ? p->name.substr(0, 18) : "-") << " │ "
+                 << right << setw(4) << j.quantity << " │ "
+                 << setw(6) << setprecision(0) << j.hours << " │ "
+                 << left << setw(16) << j.status << " │ "
+                 << setw(10) << done << " │\n";
+        }
+        if (next.empty())
+        {
+            cout << "  │ " << left << setw(85) << "Workshop queue is empty." << " │\n";
+        }
+        cout << "  └──────────────────┴────────────────────┴──────┴────────┴──────────────────┴────────────┘\n";
+
+        // --------------------------------------------------
+        // Display Menu
+        // --------------------------------------------------
+        cout << "\n   [ ACTIONS ]\n";
+        cout << "   ──────────────────────────────────────────────────────\n";
+        cout << "    1) Change Workshop Hours per Day\n";
+        cout << "\n";
+        cout << "    0) Back\n";
+        cout << "  ────────────────────────────────────────────────────────\n";
+        cout << "   Choice ➜ ";
+        choice = Utils::getValidRange(0, 1);
+
+        if (choice == 1)
+        {
+            cout << "   Hours per Day (1-24) ➜ ";
+            ProductionScheduler::setDailyHours(Utils::getValidRange(1, 24));
+        }
+    } while (choice != 0);
 }
\ No newline at end of file
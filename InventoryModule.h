@@ -4,8 +4,8 @@
 #ifndef INVENTORY_MODULE_H
 #define INVENTORY_MODULE_H
 
-// External Libraries
-#include <mysql.h> // MySQL C API
+// Internal Headers
+#include "Repository.h" // Storage-engine neutral data access
 
 class InventoryModule
 {
@@ -13,7 +13,7 @@ public:
     // ============================================================================
     // Constructor
     // ============================================================================
-    InventoryModule(MYSQL* c);
+    InventoryModule(DataStore* s);
     
     // ============================================================================
     // Public Operations
@@ -21,7 +21,7 @@ public:
     void manageInventory();
 
 private:
-    MYSQL* conn; // Database Connection Helper
+    DataStore* store; // Product and order repositories
 
     // ============================================================================
     // Private Helpers
@@ -31,6 +31,7 @@ private:
     void editProduct();
     void deleteProduct();
     void searchProduct();
+    void productionSchedule();
 };
 
 #endif
\ No newline at end of file
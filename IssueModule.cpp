@@ -11,6 +11,9 @@
 #include <cstdlib>     // System calls
 #include <limits>      // Numeric limits
 #include "Utils.h"     // Shared Utility Functions
+#include "SelectableListing.h" // Row number -> order ID for the rows on screen
+#include "ProductionScheduler.h" // Workshop backlog
+#include "OrderSearchIndex.h"   // Front-desk order search
 
 using namespace std;
 
@@ -35,32 +38,30 @@ static void printError(string msg)
 // ============================================================================
 // 4/11 processReport (Static Helper)
 // ============================================================================
-static void processReport(MYSQL* conn, string smartID)
+static void processReport(DataStore* store, string smartID)
 {
     // --------------------------------------------------
     // Validate Order ID
     // --------------------------------------------------
-    string sql = "SELECT id, expected_date FROM orders WHERE smart_id='" + smartID + "'";
+    Order order;
+    Lookup found = store->orders().findBySmartId(smartID, order);
     
-    if (mysql_query(conn, sql.c_str())) 
+    if (found == Lookup::Failed) 
     {
+        printError(store->lastError());
+        system("pause");
         return;
     }
-    
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row = mysql_fetch_row(res);
 
     // #### Not Found Check ####
-    if (!row) 
+    if (found == Lookup::Missing) 
     { 
         printError("Order Not Found.");
-        mysql_free_result(res); 
         system("pause"); 
         return; 
     }
     
-    string dbId = row[0]; 
-    mysql_free_result(res);
+    long long dbId = order.id; 
 
     // --------------------------------------------------
     // Issue Type Selection
@@ -88,36 +89,44 @@ static void processReport(MYSQL* conn, string smartID)
     if (type == 1) 
     {
         // Refund Logic: Update order status -> Log issue
-        mysql_query(conn, ("UPDATE orders SET status='Refunded' WHERE id=" + dbId).c_str());
-        string q = "INSERT INTO issues (order_id, issue_type, resolution) VALUES (" + dbId + ", 'Complaint', 'Refund: " + reason + "')";
-        mysql_query(conn, q.c_str());
+        // #### Refund Failure Check ####
+        if (!store->issues().refund(dbId, reason))
+        {
+            printError(store->lastError());
+            system("pause");
+            return;
+        }
+        ProductionScheduler::statusChanged(smartID, "Refunded");
+        OrderSearchIndex::statusChanged(smartID, "Refunded");
         printSuccess("Refund Processed");
     }
     else if (type == 2) 
     {
-        // Redo Logic: Update status & Extend Date -> Log issue
-        mysql_query(conn, ("UPDATE orders SET status='Redo In Progress', expected_date = DATE_ADD(NOW(), INTERVAL 7 DAY) WHERE id=" + dbId).c_str());
-        string q = "INSERT INTO issues (order_id, issue_type, resolution) VALUES (" + dbId + ", 'Defect', 'Redo: " + reason + "')";
-        mysql_query(conn, q.c_str());
-        
-        // Calculate Changes
-        mysql_query(conn, ("SELECT DATE(NOW()), DATE(DATE_ADD(NOW(), INTERVAL 3 DAY)), DATE(DATE_ADD(NOW(), INTERVAL 7 DAY))"));
-        MYSQL_RES* timeRes = mysql_store_result(conn);
-        MYSQL_ROW timeRow = mysql_fetch_row(timeRes);
+        // Redo Logic: Update status & Extend Date -> Log issue -> Calculate Changes
+        RedoTimeline timeline;
+
+        // #### Redo Failure Check ####
+        if (!store->issues().scheduleRedo(dbId, reason, timeline))
+        {
+            printError(store->lastError());
+            system("pause");
+            return;
+        }
+        ProductionScheduler::statusChanged(smartID, "Redo In Progress");
+        OrderSearchIndex::statusChanged(smartID, "Redo In Progress");
         
         printSuccess("Redo Scheduled Successfully");
         cout << "\n   New Timeline\n";
         cout << "   ──────────────────────────────────────────────────────\n";
         
-        if (timeRow) 
+        if (!timeline.start.empty()) 
         {
-            cout << "   Redo Start     : " << timeRow[0] << "\n";
-            cout << "   Production ETA : " << timeRow[1] << "\n";
-            cout << "   Delivery ETA   : " << timeRow[2] << "\n";
+            cout << "   Redo Start     : " << timeline.start << "\n";
+            cout << "   Production ETA : " << timeline.productionEta << "\n";
+            cout << "   Delivery ETA   : " << timeline.deliveryEta << "\n";
         }
         
         cout << "   ──────────────────────────────────────────────────────\n";
-        mysql_free_result(timeRes);
     }
     
     system("pause");
@@ -126,9 +135,9 @@ static void processReport(MYSQL* conn, string smartID)
 // ============================================================================
 // 5/11 IssueModule (Constructor)
 // ============================================================================
-IssueModule::IssueModule(MYSQL* c) 
+IssueModule::IssueModule(DataStore* s) 
 { 
-    conn = c; 
+    store = s; 
 }
 
 // ============================================================================
@@ -170,30 +179,34 @@ void IssueModule::manageIssues()
                 // Order Selection Logic
                 // --------------------------------------------------
                 system("cls");
-                mysql_query(conn, "SELECT smart_id, customer_name, status, total_price FROM orders");
-                MYSQL_RES* res = mysql_store_result(conn); 
-                MYSQL_ROW row;
+                vector<Order> orders;
+
+                // #### Query Failure Check ####
+                if (!store->orders().listAll(orders))
+                {
+                    printError(store->lastError());
+                    system("pause");
+                    break;
+                }
                 
-                int totalRows = mysql_num_rows(res);
+                SelectableListing listing;
 
                 cout << "\n   [ SELECT ORDER TO REPORT (ENTER 0 ONLY TO CANCEL) ]\n";
                 cout << "  ┌─────┬──────────────────────┬──────────────────────┬──────────────────────┐\n";
                 cout << "  │  No │ ID                   │ CUSTOMER             │ STATUS               │\n";
                 cout << "  ├─────┼──────────────────────┼──────────────────────┼──────────────────────┤\n";
                 
-                int i = 1;
-                while ((row = mysql_fetch_row(res))) 
+                for (const Order& o : orders) 
                 {
                     cout << "  │ " 
-                         << left << setw(3) << i++ << " │ " 
-                         << left << setw(20) << row[0] << " │ " 
-                         << left << setw(20) << row[1] << " │ " 
-                         << left << setw(20) << row[2] << " │\n";
+                         << left << setw(3) << listing.add(o.smartId) << " │ " 
+                         << left << setw(20) << o.smartId << " │ " 
+                         << left << setw(20) << o.customerName << " │ " 
+                         << left << setw(20) << o.status << " │\n";
                 }
                 cout << "  └─────┴──────────────────────┴──────────────────────┴──────────────────────┘\n";
-                mysql_free_result(res); 
                 
-                if (totalRows == 0) 
+                if (listing.empty()) 
                 {
                     printError("No orders available."); 
                     system("pause");
@@ -201,20 +214,10 @@ void IssueModule::manageIssues()
                 else 
                 {
                     // Select Row to Report
-                    cout << "\n   Select Row Number to Report Issue (0 to Cancel) ➜ ";
-                    int sel = Utils::getValidRange(0, totalRows);
-                    if (sel > 0 && sel <= totalRows) 
+                    string smartID = listing.select("\n   Select Row Number to Report Issue (0 to Cancel) ➜ ");
+                    if (smartID != "") 
                     {
-                        int offset = sel - 1;
-                        string getIDQ = "SELECT smart_id FROM orders LIMIT " + to_string(offset) + ", 1";
-                        mysql_query(conn, getIDQ.c_str());
-                        MYSQL_RES* resID = mysql_store_result(conn);
-                        MYSQL_ROW rowID = mysql_fetch_row(resID);
-                        if (rowID) 
-                        {
-                            processReport(conn, rowID[0]);
-                        }
-                        mysql_free_result(resID);
+                        processReport(store, smartID);
                     }
                 }
                 break;
@@ -255,7 +258,7 @@ void IssueModule::createIssue()
     }
     
     // Delegate to helper
-    processReport(conn, smartID);
+    processReport(store, smartID);
 }
 
 // ============================================================================
@@ -266,32 +269,33 @@ void IssueModule::viewIssues()
     // --------------------------------------------------
     // Fetch Issues
     // --------------------------------------------------
-    string sql = "SELECT issues.id, orders.smart_id, issues.issue_type, issues.resolution, issues.log_date FROM issues JOIN orders ON issues.order_id = orders.id";
-    mysql_query(conn, sql.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row;
+    vector<Issue> issues;
+
+    // #### Query Failure Check ####
+    if (!store->issues().listAll(issues))
+    {
+        printError(store->lastError());
+        return;
+    }
 
     cout << "\n   [ ISSUE HISTORY ]\n";
     cout << "  ┌─────┬──────────────────────┬─────────────────┬────────────────────────────────────────┐\n";
     cout << "  │ ID  │ ORDER ID             │ TYPE            │ DETAILS & RESOLUTION                   │\n";
     cout << "  ├─────┼──────────────────────┼─────────────────┼────────────────────────────────────────┤\n";
     
-    int rows = 0;
-    while ((row = mysql_fetch_row(res))) 
+    for (const Issue& i : issues) 
     {
-        rows++;
         cout << "  │ " 
-             << left << setw(3) << row[0] << " │ " 
-             << left << setw(20) << row[1] << " │ " 
-             << left << setw(15) << row[2] << " │ " 
-             << left << setw(38) << row[3] << " │\n";
+             << left << setw(3) << i.id << " │ " 
+             << left << setw(20) << i.smartId << " │ " 
+             << left << setw(15) << i.issueType << " │ " 
+             << left << setw(38) << i.resolution << " │\n";
     }
-    if (rows == 0)
+    if (issues.empty())
     {
          cout << "  │ " << setw(86) << "No issues found." << " │\n";
     }
     cout << "  └─────┴──────────────────────┴─────────────────┴────────────────────────────────────────┘\n";
-    mysql_free_result(res); 
 }
 
 // ============================================================================
@@ -310,19 +314,15 @@ void IssueModule::updateIssue()
     // --------------------------------------------------
     // Validate ID
     // --------------------------------------------------
-    string check = "SELECT id FROM issues WHERE id=" + to_string(id);
-    mysql_query(conn, check.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
+    Issue issue;
     
     // #### Not Found Check ####
-    if (mysql_num_rows(res) == 0) 
+    if (store->issues().find(id, issue) != Lookup::Found) 
     {
         printError("Issue ID not found.");
-        mysql_free_result(res); 
         system("pause"); 
         return;
     }
-    mysql_free_result(res);
 
     string newRes;
     cout << "   Enter New Resolution (e.g. Solved, Closed) ➜ "; 
@@ -331,15 +331,13 @@ void IssueModule::updateIssue()
     // --------------------------------------------------
     // Perform Update
     // --------------------------------------------------
-    string query = "UPDATE issues SET resolution='" + newRes + "' WHERE id=" + to_string(id);
-    
-    if (!mysql_query(conn, query.c_str())) 
+    if (store->issues().updateResolution(id, newRes)) 
     {
         printSuccess("Issue Updated");
     }
     else 
     {
-        printError("Failed to update.");
+        printError("Failed to update. " + store->lastError());
     }
     system("pause");
 }
@@ -359,19 +357,15 @@ void IssueModule::deleteIssue()
     // --------------------------------------------------
     // Validate ID
     // --------------------------------------------------
-    string check = "SELECT id FROM issues WHERE id=" + to_string(id);
-    mysql_query(conn, check.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
+    Issue issue;
     
     // #### Not Found Check ####
-    if (mysql_num_rows(res) == 0) 
+    if (store->issues().find(id, issue) != Lookup::Found) 
     {
         printError("Issue ID not found.");
-        mysql_free_result(res); 
         system("pause"); 
         return;
     }
-    mysql_free_result(res);
 
     cout << "   Are you sure? (1=Yes, 0=No) ➜ ";
     int confirm = Utils::getValidRange(0, 1);
@@ -383,15 +377,13 @@ void IssueModule::deleteIssue()
     // --------------------------------------------------
     // Perform Deletion
     // --------------------------------------------------
-    string query = "DELETE FROM issues WHERE id=" + to_string(id);
-    
-    if (!mysql_query(conn, query.c_str())) 
+    if (store->issues().remove(id)) 
     {
         printSuccess("Record Deleted");
     }
     else 
     {
-        printError("Failed to delete.");
+        printError("Failed to delete. " + store->lastError());
     }
     system("pause");
 }
@@ -412,17 +404,14 @@ void IssueModule::searchIssue()
     // --------------------------------------------------
     // Search Query
     // --------------------------------------------------
-    string query = "SELECT issues.id, orders.smart_id, issues.issue_type, issues.resolution "
-                   "FROM issues JOIN orders ON issues.order_id = orders.id "
-                   "WHERE issues.issue_type LIKE '%" + keyword + "%' OR issues.resolution LIKE '%" + keyword + "%'";
+    vector<Issue> matches;
     
-    if (mysql_query(conn, query.c_str())) 
+    if (!store->issues().search(keyword, matches)) 
     {
+        printError(store->lastError());
+        system("pause");
         return;
     }
-    
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
 
     cout << "\n   [ SEARCH RESULTS ]\n";
     cout << "  ┌─────┬──────────────────────┬─────────────────┬────────────────────────────────────────┐\n";
@@ -430,14 +419,14 @@ void IssueModule::searchIssue()
     cout << "  ├─────┼──────────────────────┼─────────────────┼────────────────────────────────────────┤\n";
     
     bool found = false;
-    while ((row = mysql_fetch_row(res))) 
+    for (const Issue& i : matches) 
     {
         found = true;
         cout << "  │ " 
-             << left << setw(3) << row[0] << " │ " 
-             << left << setw(20) << row[1] << " │ " 
-             << left << setw(15) << row[2] << " │ " 
-             << left << setw(38) << row[3] << " │\n";
+             << left << setw(3) << i.id << " │ " 
+             << left << setw(20) << i.smartId << " │ " 
+             << left << setw(15) << i.issueType << " │ " 
+             << left << setw(38) << i.resolution << " │\n";
     }
     cout << "  └─────┴──────────────────────┴─────────────────┴────────────────────────────────────────┘\n";
     
@@ -447,6 +436,5 @@ void IssueModule::searchIssue()
         cout << "   \033[1;31mNo issues found matching '" << keyword << "'.\033[0m\n";
     }
     
-    mysql_free_result(res); 
     system("pause");
 }
\ No newline at end of file
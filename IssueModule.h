@@ -4,8 +4,8 @@
 #ifndef ISSUE_MODULE_H
 #define ISSUE_MODULE_H
 
-// External Libraries
-#include <mysql.h> // MySQL C API for database interaction
+// Internal Headers
+#include "Repository.h" // Storage-engine neutral data access
 
 class IssueModule
 {
@@ -13,7 +13,7 @@ public:
     // ============================================================================
     // Constructor
     // ============================================================================
-    IssueModule(MYSQL* c);
+    IssueModule(DataStore* s);
     
     // ============================================================================
     // Public Operations
@@ -21,7 +21,7 @@ public:
     void manageIssues();
 
 private:
-    MYSQL* conn; // Database Connection Handler
+    DataStore* store; // Issue and order repositories
     
     // ============================================================================
     // Private Helpers
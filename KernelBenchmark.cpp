@@ -0,0 +1,140 @@
+// ============================================================================
+// KERNEL BENCHMARK IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "KernelBenchmark.h"
+#include "AggregateKernels.h" // Kernel sets under test
+#include "Format.h"           // Day numbers for benchmark data
+
+// Standard Libraries
+#include <iostream>    // Result table
+#include <iomanip>     // Formatting (setw)
+#include <vector>      // Synthetic columns
+#include <functional>  // Timed runs
+#include <algorithm>   // min, max
+#include <chrono>      // Benchmark timing
+#include <random>      // Benchmark data
+
+using namespace std;
+
+// ============================================================================
+// 1/1 run
+// ============================================================================
+void KernelBenchmark::run(int millions)
+{
+    cout << "\n  =======================================================\n";
+    cout << "    AGGREGATION KERNEL BENCHMARK\n";
+    cout << "  =======================================================\n";
+    cout << "   Synthetic snapshot columns, filtered to Completed orders\n";
+    cout << "   of one year, grouped by month x product.\n\n";
+
+    // --------------------------------------------------
+    // Generate Columns (Two Years, 8 Products, 5 Statuses)
+    // --------------------------------------------------
+    size_t n = (size_t)millions * 1000000;
+    cout << "   Generating " << n << " rows...\n";
+    int32_t firstDay = Format::dayNumber(2025, 1, 1);
+    vector<int32_t> day(n);
+    vector<uint16_t> product(n);
+    vector<int32_t> quantity(n);
+    vector<int64_t> cents(n);
+    vector<uint8_t> status(n);
+    mt19937 rng(42);
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t r = rng();
+        day[i] = firstDay + (int32_t)(r % 730);
+        product[i] = (uint16_t)(1 + (r >> 10) % 8);
+        quantity[i] = 1 + (int32_t)((r >> 14) % 5);
+        status[i] = (uint8_t)((r >> 18) % 5);
+        cents[i] = 500 + (int64_t)(rng() % 50000);
+    }
+
+    RowFilter filter{0, firstDay, Format::dayNumber(2026, 1, 1)};
+    vector<int32_t> dayGroup(filter.toDay - filter.fromDay);
+    for (int32_t d = filter.fromDay; d < filter.toDay; d++)
+    {
+        int y, m, dd;
+        Format::civilDate(d, y, m, dd);
+        dayGroup[d - filter.fromDay] = m - 1;
+    }
+    vector<int32_t> productSlot(9);
+    for (int p = 0; p < 9; p++) productSlot[p] = p;
+
+    // --------------------------------------------------
+    // Time Each Kernel (Best Of 3 Runs)
+    // --------------------------------------------------
+    struct Timing
+    {
+        double ms[2];
+        int64_t result[2];
+    };
+    const size_t BLOCK = 4096;
+    vector<int32_t> keys(BLOCK);
+    auto timed = [](const function<int64_t()>& run, double& best) -> int64_t
+    {
+        int64_t result = 0;
+        best = 1e30;
+        for (int rep = 0; rep < 3; rep++)
+        {
+            auto start = chrono::steady_clock::now();
+            result = run();
+            best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        return result;
+    };
+
+    const KernelSet* sets[2] = {&AggregateKernels::scalar(), AggregateKernels::avx2()};
+    Timing t[4] = {};
+    for (int s = 0; s < 2; s++)
+    {
+        const KernelSet* k = sets[s];
+        if (!k) continue;
+        t[0].result[s] = timed([&]() { return k->sum(cents.data(), status.data(), day.data(), n, filter); }, t[0].ms[s]);
+        t[1].result[s] = timed([&]() { return (int64_t)k->count(status.data(), day.data(), n, filter); }, t[1].ms[s]);
+        t[2].result[s] = timed([&]()
+        {
+            int64_t lo, hi;
+            k->minMax(cents.data(), status.data(), day.data(), n, filter, lo, hi);
+            return lo * 1000003 + hi;
+        }, t[2].ms[s]);
+        t[3].result[s] = timed([&]()
+        {
+            vector<int64_t> byCents(12 * 9), byQty(12 * 9), byCount(12 * 9);
+            for (size_t at = 0; at < n; at += BLOCK)
+            {
+                size_t len = min(BLOCK, n - at);
+                k->groupKeys(&status[at], &day[at], &product[at], len, filter, dayGroup.data(), productSlot.data(), 9, keys.data());
+                k->groupSum(keys.data(), &cents[at], &quantity[at], len, byCents.data(), byQty.data(), byCount.data());
+            }
+            uint64_t check = 0;
+            for (size_t g = 0; g < byCents.size(); g++) check = check * 31 + (uint64_t)(byCents[g] + byQty[g] * 7 + byCount[g] * 13);
+            return (int64_t)check;
+        }, t[3].ms[s]);
+    }
+
+    // --------------------------------------------------
+    // Results
+    // --------------------------------------------------
+    const char* names[4] = {"Masked sum (revenue)", "Masked count", "Masked min / max", "Group-by month x product"};
+    cout << "\n  ┌──────────────────────────┬────────────┬────────────┬─────────┬─────────┐\n";
+    cout << "  │ KERNEL                   │ SCALAR ms  │ AVX2 ms    │ SPEEDUP │ RESULTS │\n";
+    cout << "  ├──────────────────────────┼────────────┼────────────┼─────────┼─────────┤\n";
+    for (int i = 0; i < 4; i++)
+    {
+        cout << "  │ " << left << setw(24) << names[i] << " │ " << right << setw(10) << fixed << setprecision(2) << t[i].ms[0] << " │ ";
+        if (sets[1])
+        {
+            cout << setw(10) << t[i].ms[1] << " │ " << setw(6) << setprecision(1) << t[i].ms[0] / max(t[i].ms[1], 0.001) << "x │ "
+                 << left << setw(7) << (t[i].result[0] == t[i].result[1] ? "match" : "DIFFER") << " │\n";
+        }
+        else
+        {
+            cout << setw(10) << "-" << " │ " << setw(7) << "-" << " │ " << left << setw(7) << "-" << " │\n";
+        }
+    }
+    cout << "  └──────────────────────────┴────────────┴────────────┴─────────┴─────────┘\n";
+    cout << "   Active kernels for reports: " << AggregateKernels::active().name << "\n";
+    cout.unsetf(ios::fixed);
+    cout << setprecision(6);
+}
\ No newline at end of file
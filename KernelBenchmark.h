@@ -0,0 +1,22 @@
+// ============================================================================
+// KERNEL BENCHMARK HEADER
+// ============================================================================
+#ifndef KERNEL_BENCHMARK_H
+#define KERNEL_BENCHMARK_H
+
+using namespace std;
+
+// ============================================================================
+// KernelBenchmark
+// Times every AggregateKernels set on synthetic snapshot columns and checks
+// that they agree. Run from the command line (--bench-kernels), not from the
+// report screens, so the allocation and the CPU time stay off the terminals.
+// ============================================================================
+class KernelBenchmark
+{
+public:
+    // millions of rows, 1-50
+    static void run(int millions);
+};
+
+#endif
\ No newline at end of file
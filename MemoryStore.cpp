@@ -0,0 +1,975 @@
+// ============================================================================
+// MEMORY STORE IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "MemoryStore.h"
+
+// Standard Libraries
+#include <ctime>       // Timestamps for new rows
+#include <cstdio>      // snprintf for date prefixes
+#include <cstdlib>     // atoi
+#include <cctype>      // Case-insensitive matching
+#include <algorithm>   // partial_sort, reverse
+#include <unordered_set> // Smart ids within a bulk chunk
+#include <set>         // Orders in a change feed
+#include <climits>     // Lowest product id for rollup range scans
+#include <cmath>       // llround for rollup checks and cents
+#include "Format.h"    // Row timestamps, day numbers
+
+using namespace std;
+
+typedef lock_guard<recursive_mutex> TableLock;
+
+// ============================================================================
+// 1/9 Local Helpers
+// ============================================================================
+// Local time as "YYYY-MM-DD HH:MM:SS", offset by whole days
+static string timestamp(int dayOffset)
+{
+    return Format::stamp(time(0) + (time_t)dayOffset * 24 * 3600);
+}
+
+// LIKE '%keyword%' under the default case-insensitive collation
+static bool containsNoCase(const string& text, const string& keyword)
+{
+    auto same = [](char a, char b) { return tolower((unsigned char)a) == tolower((unsigned char)b); };
+    return search(text.begin(), text.end(), keyword.begin(), keyword.end(), same) != text.end();
+}
+
+// Removes the single (key, id) entry from a multi-index
+template <typename Index, typename Key, typename Id>
+static void eraseEntry(Index& index, const Key& key, Id id)
+{
+    auto range = index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == id)
+        {
+            index.erase(it);
+            return;
+        }
+    }
+}
+
+// Best and worst sellers (by units) from per-product totals
+static pair<ItemQty, ItemQty> pickBestWorst(const map<string, long long>& units)
+{
+    pair<ItemQty, ItemQty> items(ItemQty{"-", 0}, ItemQty{"-", 0});
+    bool first = true;
+    for (const auto& u : units)
+    {
+        if (first || u.second > items.first.qty)  items.first = ItemQty{u.first, u.second};
+        if (first || u.second < items.second.qty) items.second = ItemQty{u.first, u.second};
+        first = false;
+    }
+    return items;
+}
+
+// Adds one order to (sign 1) or takes it back out of (sign -1) the daily sales rollup
+static void rollup(MemoryTables* db, const Order& o, int sign)
+{
+    auto key = make_tuple(o.status, o.orderDate.substr(0, 10), o.productId);
+    DailySales& d = db->dailySales[key];
+    d.qty += sign * (long long)o.quantity;
+    d.revenue += sign * o.totalPrice;
+    d.orders += sign;
+    if (d.orders <= 0) db->dailySales.erase(key);
+}
+
+// Appends an order to the change feed
+static void logChange(MemoryTables* db, long long orderId)
+{
+    db->orderChanges[db->nextChangeVersion++] = orderId;
+}
+
+// Moves one order to a new status, carrying its rollup row along
+static void setStatus(MemoryTables* db, Order& o, const string& status)
+{
+    rollup(db, o, -1);
+    o.status = status;
+    rollup(db, o, 1);
+    logChange(db, o.id);
+}
+
+static const char* FK_ERROR = "Cannot add or update a child row: a foreign key constraint fails";
+static const char* FK_PARENT_ERROR = "Cannot delete or update a parent row: a foreign key constraint fails";
+
+// ============================================================================
+// 2/9 MemoryStore
+// ============================================================================
+MemoryStore::MemoryStore()
+    : productRepo(&tables), orderRepo(&tables), issueRepo(&tables), adminRepo(&tables)
+{
+    tables.nextProductId = 1;
+    tables.nextOrderId = 1;
+    tables.nextIssueId = 1;
+    tables.nextAdminId = 1;
+    tables.nextChangeVersion = 1;
+}
+
+void MemoryStore::seedDefaults()
+{
+    // Same base rows as souvenir_system_setup.sql
+    Admin admins[] = {
+        {0, "admin", "123", "Manager"},
+        {0, "staff", "123", "Staff"},
+        {0, "dhivya", "123", "Manager"},
+    };
+    for (Admin& a : admins) adminRepo.add(a);
+
+    Product products[] = {
+        {0, "FAIX Lanyard", "Ready Stock", 15.00, 43, 0},
+        {0, "FAIX T-Shirt", "Ready Stock", 35.00, 5, 0},
+        {0, "FAIX Cap", "Ready Stock", 29.00, 20, 0},
+        {0, "Phone Case", "Custom", 25.00, 0, 24},
+        {0, "T-Shirt", "Custom", 40.00, 0, 48},
+    };
+    for (Product& p : products) productRepo.add(p);
+}
+
+ProductRepository& MemoryStore::products() { return productRepo; }
+OrderRepository& MemoryStore::orders() { return orderRepo; }
+IssueRepository& MemoryStore::issues() { return issueRepo; }
+AdminRepository& MemoryStore::admins() { return adminRepo; }
+
+string MemoryStore::lastError()
+{
+    TableLock guard(tables.lock);
+    return tables.error;
+}
+
+// ============================================================================
+// 3/9 MemoryProductRepository (Listing)
+// ============================================================================
+MemoryProductRepository::MemoryProductRepository(MemoryTables* t)
+{
+    db = t;
+}
+
+bool MemoryProductRepository::listAll(vector<Product>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    out.reserve(db->products.size());
+    for (const auto& p : db->products) out.push_back(p.second);
+    return true;
+}
+
+Lookup MemoryProductRepository::find(int id, Product& out)
+{
+    TableLock guard(db->lock);
+    auto it = db->products.find(id);
+    if (it == db->products.end()) return Lookup::Missing;
+    out = it->second;
+    return Lookup::Found;
+}
+
+bool MemoryProductRepository::searchByName(const string& keyword, vector<Product>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    for (const auto& p : db->products)
+    {
+        if (containsNoCase(p.second.name, keyword)) out.push_back(p.second);
+    }
+    return true;
+}
+
+// ============================================================================
+// 4/9 MemoryProductRepository (Writes)
+// ============================================================================
+bool MemoryProductRepository::add(Product& p)
+{
+    TableLock guard(db->lock);
+    p.id = db->nextProductId++;
+    db->products[p.id] = p;
+    return true;
+}
+
+bool MemoryProductRepository::update(const Product& p)
+{
+    TableLock guard(db->lock);
+    auto it = db->products.find(p.id);
+    // An UPDATE matching no row is not an error
+    if (it != db->products.end()) it->second = p;
+    return true;
+}
+
+bool MemoryProductRepository::remove(int id)
+{
+    TableLock guard(db->lock);
+
+    // #### Foreign Key Check ####
+    if (db->ordersByProduct.count(id) > 0)
+    {
+        db->error = FK_PARENT_ERROR;
+        return false;
+    }
+    db->products.erase(id);
+    return true;
+}
+
+bool MemoryProductRepository::adjustStock(int id, int delta)
+{
+    TableLock guard(db->lock);
+    auto it = db->products.find(id);
+    if (it != db->products.end()) it->second.stock += delta;
+    return true;
+}
+
+// ============================================================================
+// 5/9 MemoryOrderRepository (Orders)
+// ============================================================================
+MemoryOrderRepository::MemoryOrderRepository(MemoryTables* t)
+{
+    db = t;
+}
+
+Order MemoryOrderRepository::joined(const Order& o)
+{
+    Order row = o;
+    auto p = db->products.find(o.productId);
+    row.productName = (p != db->products.end()) ? p->second.name : "";
+    return row;
+}
+
+bool MemoryOrderRepository::listAll(vector<Order>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    out.reserve(db->orders.size());
+    for (const auto& o : db->orders) out.push_back(joined(o.second));
+    return true;
+}
+
+Lookup MemoryOrderRepository::findBySmartId(const string& smartId, Order& out)
+{
+    TableLock guard(db->lock);
+    auto it = db->orderBySmartId.find(smartId);
+    if (it == db->orderBySmartId.end()) return Lookup::Missing;
+    out = joined(db->orders[it->second]);
+    return Lookup::Found;
+}
+
+bool MemoryOrderRepository::reserveDailySequences(int count, int& first, int& day)
+{
+    TableLock guard(db->lock);
+    tm now;
+    Format::localTime(time(0), now);
+    day = Format::dayNumber(1900 + now.tm_year, 1 + now.tm_mon, now.tm_mday);
+
+    char key[Format::DATE_LEN + 1];
+    Format::writeDay(key, day);
+    int& last = db->dailySequence[key];
+    first = last + 1;
+    last += count;
+    return true;
+}
+
+bool MemoryOrderRepository::countByProduct(int productId, int& out)
+{
+    TableLock guard(db->lock);
+    out = (int)db->ordersByProduct.count(productId);
+    return true;
+}
+
+bool MemoryOrderRepository::listByStatus(const vector<string>& statuses, vector<Order>& out)
+{
+    TableLock guard(db->lock);
+    unordered_set<string> wanted(statuses.begin(), statuses.end());
+    out.clear();
+    for (const auto& d : db->ordersByDate)
+    {
+        const Order& o = db->orders[d.second];
+        if (wanted.count(o.status) > 0) out.push_back(joined(o));
+    }
+    return true;
+}
+
+bool MemoryOrderRepository::listAfterId(long long afterId, vector<Order>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    for (auto it = db->orders.upper_bound(afterId); it != db->orders.end(); ++it) out.push_back(joined(it->second));
+    return true;
+}
+
+bool MemoryOrderRepository::insert(Order& o)
+{
+    TableLock guard(db->lock);
+
+    // #### Key Checks ####
+    if (db->products.count(o.productId) == 0)
+    {
+        db->error = FK_ERROR;
+        return false;
+    }
+    if (db->orderBySmartId.count(o.smartId) > 0)
+    {
+        db->error = "Duplicate entry '" + o.smartId + "' for key 'smart_id'";
+        return false;
+    }
+
+    o.id = db->nextOrderId++;
+    if (o.orderDate.empty()) o.orderDate = timestamp(0);
+    if (o.status.empty()) o.status = "Pending";
+
+    Order& row = db->orders[o.id];
+    row = o;
+    row.productName.clear();
+    db->orderBySmartId[o.smartId] = o.id;
+    db->ordersByDate.insert(make_pair(o.orderDate, o.id));
+    db->ordersByProduct.insert(make_pair(o.productId, o.id));
+    rollup(db, row, 1);
+    logChange(db, o.id);
+    return true;
+}
+
+bool MemoryOrderRepository::updateStatus(const string& smartId, const string& status)
+{
+    TableLock guard(db->lock);
+    auto it = db->orderBySmartId.find(smartId);
+    if (it != db->orderBySmartId.end()) setStatus(db, db->orders[it->second], status);
+    return true;
+}
+
+bool MemoryOrderRepository::remove(const string& smartId)
+{
+    TableLock guard(db->lock);
+    auto it = db->orderBySmartId.find(smartId);
+    if (it == db->orderBySmartId.end()) return true;
+
+    long long id = it->second;
+
+    // #### Foreign Key Check ####
+    if (db->issuesByOrder.count(id) > 0)
+    {
+        db->error = FK_PARENT_ERROR;
+        return false;
+    }
+
+    const Order& row = db->orders[id];
+    rollup(db, row, -1);
+    logChange(db, id);
+    eraseEntry(db->ordersByDate, row.orderDate, id);
+    eraseEntry(db->ordersByProduct, row.productId, id);
+    db->orderBySmartId.erase(it);
+    db->orders.erase(id);
+    return true;
+}
+
+PlaceResult MemoryOrderRepository::place(Order& o, bool deductStock)
+{
+    // Check, insert and decrement under one lock hold, the equivalent of the MySQL transaction
+    TableLock guard(db->lock);
+
+    auto p = db->products.find(o.productId);
+    if (deductStock && p != db->products.end() && p->second.stock < o.quantity)
+    {
+        return PlaceResult::OutOfStock;
+    }
+    if (!insert(o))
+    {
+        return PlaceResult::Failed;
+    }
+    if (deductStock)
+    {
+        p->second.stock -= o.quantity;
+    }
+    return PlaceResult::Placed;
+}
+
+bool MemoryOrderRepository::browse(const OrderFilter& filter, const OrderSeek& seek, int limit, vector<Order>& out)
+{
+    TableLock guard(db->lock);
+
+    // Equal dates keep insertion order in the multimap, and ids only grow, so the index runs in (order_date, id) order
+    auto matches = [&](const pair<const string, long long>& e)
+    {
+        if (!filter.fromDate.empty() && e.first.compare(0, 10, filter.fromDate) < 0) return false;
+        if (!filter.toDate.empty() && e.first.compare(0, 10, filter.toDate) > 0) return false;
+        return filter.status.empty() || db->orders[e.second].status == filter.status;
+    };
+
+    // First entry at or past the seek key
+    auto pos = db->ordersByDate.end();
+    if (!seek.orderDate.empty())
+    {
+        pos = db->ordersByDate.lower_bound(seek.orderDate);
+        while (pos != db->ordersByDate.end() && pos->first == seek.orderDate && pos->second < seek.id) ++pos;
+    }
+
+    out.clear();
+    if (seek.orderDate.empty() || seek.older)
+    {
+        // Walk down from the key: already newest first
+        while (pos != db->ordersByDate.begin() && (int)out.size() < limit)
+        {
+            --pos;
+            if (matches(*pos)) out.push_back(joined(db->orders[pos->second]));
+        }
+        return true;
+    }
+
+    // Walk up from the key, then flip to newest first
+    if (pos != db->ordersByDate.end() && pos->first == seek.orderDate && pos->second == seek.id) ++pos;
+    for (; pos != db->ordersByDate.end() && (int)out.size() < limit; ++pos)
+    {
+        if (matches(*pos)) out.push_back(joined(db->orders[pos->second]));
+    }
+    reverse(out.begin(), out.end());
+    return true;
+}
+
+PlaceResult MemoryOrderRepository::placeBulk(const vector<Order>& orders, const map<int, int>& stockTaken)
+{
+    TableLock guard(db->lock);
+
+    // #### Stock Check ####
+    for (const pair<const int, int>& t : stockTaken)
+    {
+        auto p = db->products.find(t.first);
+        if (p != db->products.end() && p->second.stock < t.second)
+        {
+            return PlaceResult::OutOfStock;
+        }
+    }
+
+    // #### Key Checks ####
+    // Everything is checked before the first row goes in, so a failure leaves no partial chunk
+    unordered_set<string> seen;
+    for (const Order& o : orders)
+    {
+        if (db->products.count(o.productId) == 0)
+        {
+            db->error = FK_ERROR;
+            return PlaceResult::Failed;
+        }
+        if (db->orderBySmartId.count(o.smartId) > 0 || !seen.insert(o.smartId).second)
+        {
+            db->error = "Duplicate entry '" + o.smartId + "' for key 'smart_id'";
+            return PlaceResult::Failed;
+        }
+    }
+
+    for (const Order& o : orders)
+    {
+        Order row = o;
+        insert(row);
+    }
+    for (const pair<const int, int>& t : stockTaken)
+    {
+        auto p = db->products.find(t.first);
+        if (p != db->products.end()) p->second.stock -= t.second;
+    }
+    return PlaceResult::Placed;
+}
+
+// Filter half of a selection; id lists go through the smart_id index instead
+bool MemoryOrderRepository::selected(const OrderSelection& sel, const Order& o)
+{
+    if (!sel.filter.status.empty() && o.status != sel.filter.status) return false;
+    if (!sel.filter.fromDate.empty() && o.orderDate.compare(0, 10, sel.filter.fromDate) < 0) return false;
+    if (!sel.filter.toDate.empty() && o.orderDate.compare(0, 10, sel.filter.toDate) > 0) return false;
+    return sel.productId == 0 || o.productId == sel.productId;
+}
+
+bool MemoryOrderRepository::countByStatus(const OrderSelection& sel, map<string, int>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    if (!sel.smartIds.empty())
+    {
+        // Resolve the list through the smart_id index instead of scanning every order
+        unordered_set<string> ids(sel.smartIds.begin(), sel.smartIds.end());
+        for (const string& id : ids)
+        {
+            auto it = db->orderBySmartId.find(id);
+            if (it != db->orderBySmartId.end()) out[db->orders[it->second].status]++;
+        }
+        return true;
+    }
+    for (const auto& o : db->orders)
+    {
+        if (selected(sel, o.second)) out[o.second.status]++;
+    }
+    return true;
+}
+
+bool MemoryOrderRepository::bulkUpdateStatus(const OrderSelection& sel, const vector<string>& from, const string& to,
+                                             int chunkSize, long long& updated)
+{
+    (void)chunkSize; // One lock hold already makes the whole change atomic
+    TableLock guard(db->lock);
+    updated = 0;
+
+    auto apply = [&](Order& o)
+    {
+        if (find(from.begin(), from.end(), o.status) == from.end()) return;
+        setStatus(db, o, to);
+        updated++;
+    };
+
+    if (!sel.smartIds.empty())
+    {
+        unordered_set<string> ids(sel.smartIds.begin(), sel.smartIds.end());
+        for (const string& id : ids)
+        {
+            auto it = db->orderBySmartId.find(id);
+            if (it != db->orderBySmartId.end()) apply(db->orders[it->second]);
+        }
+        return true;
+    }
+    for (auto& o : db->orders)
+    {
+        if (selected(sel, o.second)) apply(o.second);
+    }
+    return true;
+}
+
+// ============================================================================
+// 6/9 MemoryOrderRepository (Sales Reports)
+// ============================================================================
+bool MemoryOrderRepository::salesByPeriod(const PeriodScope& scope, vector<PeriodSales>& out)
+{
+    pair<ItemQty, ItemQty> overall;
+    return salesTrend(scope, out, overall);
+}
+
+bool MemoryOrderRepository::salesTrend(const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall)
+{
+    TableLock guard(db->lock);
+
+    struct Bucket
+    {
+        double revenue;
+        map<string, long long> units; // Product name -> quantity
+    };
+    map<string, Bucket> buckets;
+    map<string, long long> units;     // Product name -> quantity over every period in scope
+
+    // --------------------------------------------------
+    // Range Scan Over The Completed Day Rollup
+    // --------------------------------------------------
+    string prefix;
+    if (scope.year > 0)
+    {
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%04d", scope.year);
+        prefix = buf;
+        if (scope.month > 0)
+        {
+            snprintf(buf, sizeof(buf), "-%02d", scope.month);
+            prefix += buf;
+        }
+    }
+
+    const string completed = "Completed";
+    for (auto it = db->dailySales.lower_bound(make_tuple(completed, prefix, INT_MIN)); it != db->dailySales.end(); ++it)
+    {
+        const string& day = get<1>(it->first);
+        if (get<0>(it->first) != completed || day.compare(0, prefix.size(), prefix) != 0) break;
+
+        // Month filter without a year cannot use the prefix
+        if (scope.year == 0 && scope.month > 0 && atoi(day.substr(5, 2).c_str()) != scope.month) continue;
+
+        string key;
+        if (scope.unit == Period::Day)        key = day;
+        else if (scope.unit == Period::Week)  key = to_string((atoi(day.substr(8, 2).c_str()) - 1) / 7 + 1);
+        else if (scope.unit == Period::Month) key = day.substr(0, 7);
+        else                                  key = day.substr(0, 4);
+
+        const DailySales& d = it->second;
+        Bucket& b = buckets[key];
+        b.revenue += d.revenue;
+        auto p = db->products.find(get<2>(it->first));
+        if (p != db->products.end())
+        {
+            b.units[p->second.name] += d.qty;
+            units[p->second.name] += d.qty;
+        }
+    }
+    overall = pickBestWorst(units);
+
+    // --------------------------------------------------
+    // Emit In Requested Order
+    // --------------------------------------------------
+    out.clear();
+    auto emit = [&](const pair<const string, Bucket>& b)
+    {
+        pair<ItemQty, ItemQty> items = pickBestWorst(b.second.units);
+        out.push_back(PeriodSales{b.first, b.second.revenue, items.first, items.second});
+    };
+
+    if (scope.newestFirst)
+    {
+        for (auto it = buckets.rbegin(); it != buckets.rend(); ++it)
+        {
+            if (scope.limit > 0 && (int)out.size() >= scope.limit) break;
+            emit(*it);
+        }
+    }
+    else
+    {
+        for (auto it = buckets.begin(); it != buckets.end(); ++it)
+        {
+            if (scope.limit > 0 && (int)out.size() >= scope.limit) break;
+            emit(*it);
+        }
+    }
+    return true;
+}
+
+bool MemoryOrderRepository::extremeOrders(bool highest, int limit, vector<Order>& out)
+{
+    TableLock guard(db->lock);
+    vector<const Order*> completed;
+    for (const auto& o : db->orders)
+    {
+        if (o.second.status == "Completed") completed.push_back(&o.second);
+    }
+
+    size_t n = min((size_t)max(limit, 0), completed.size());
+    partial_sort(completed.begin(), completed.begin() + n, completed.end(), [highest](const Order* a, const Order* b)
+    {
+        return highest ? a->totalPrice > b->totalPrice : a->totalPrice < b->totalPrice;
+    });
+
+    out.clear();
+    for (size_t i = 0; i < n; i++) out.push_back(joined(*completed[i]));
+    return true;
+}
+
+bool MemoryOrderRepository::rebuildSalesRollup(long long& rows)
+{
+    TableLock guard(db->lock);
+    db->dailySales.clear();
+    for (const auto& o : db->orders) rollup(db, o.second, 1);
+    rows = (long long)db->dailySales.size();
+    return true;
+}
+
+bool MemoryOrderRepository::verifySalesRollup(long long& mismatches)
+{
+    TableLock guard(db->lock);
+
+    // Rebuilt aside, then compared row by row in key order
+    MemoryTables fresh;
+    for (const auto& o : db->orders) rollup(&fresh, o.second, 1);
+
+    auto same = [](const DailySales& a, const DailySales& b)
+    {
+        // Revenue is summed in a different order, so compare it to the cent
+        return a.qty == b.qty && a.orders == b.orders && llround(a.revenue * 100) == llround(b.revenue * 100);
+    };
+
+    mismatches = 0;
+    auto kept = db->dailySales.begin();
+    auto want = fresh.dailySales.begin();
+    while (kept != db->dailySales.end() || want != fresh.dailySales.end())
+    {
+        if (want == fresh.dailySales.end() || (kept != db->dailySales.end() && kept->first < want->first))
+        {
+            mismatches++;
+            ++kept;
+        }
+        else if (kept == db->dailySales.end() || want->first < kept->first)
+        {
+            mismatches++;
+            ++want;
+        }
+        else
+        {
+            if (!same(kept->second, want->second)) mismatches++;
+            ++kept;
+            ++want;
+        }
+    }
+    return true;
+}
+
+bool MemoryOrderRepository::forEachChange(const string& reader, long long& version, const function<void(const OrderFact&)>& visit)
+{
+    TableLock guard(db->lock);
+
+    // #### Pruned Reader Check ####
+    // Dropped while away: the changes it needed may be gone
+    if (version > 0 && db->changeReaders.count(reader) == 0)
+    {
+        version = 0;
+        return true;
+    }
+    auto fact = [](const Order& o)
+    {
+        int day = Format::dayNumber(atoi(o.orderDate.substr(0, 4).c_str()), atoi(o.orderDate.substr(5, 2).c_str()),
+                                    atoi(o.orderDate.substr(8, 2).c_str()));
+        return OrderFact{o.id, day, o.productId, o.quantity, llround(o.totalPrice * 100), o.status, false};
+    };
+
+    // #### Full Load ####
+    if (version == 0)
+    {
+        for (const auto& o : db->orders) visit(fact(o.second));
+        version = db->nextChangeVersion - 1;
+        db->changeReaders[reader] = ChangeReader{version, time(0)};
+        return true;
+    }
+
+    // Each order once, however often it changed
+    set<long long> changed;
+    for (auto it = db->orderChanges.upper_bound(version); it != db->orderChanges.end(); ++it) changed.insert(it->second);
+    for (long long id : changed)
+    {
+        auto o = db->orders.find(id);
+        if (o != db->orders.end()) visit(fact(o->second));
+        else                       visit(OrderFact{id, 0, 0, 0, 0, "", true});
+    }
+    version = db->nextChangeVersion - 1;
+    db->changeReaders[reader] = ChangeReader{version, time(0)};
+    return true;
+}
+
+bool MemoryOrderRepository::latestChangeVersion(const string& reader, long long& version)
+{
+    TableLock guard(db->lock);
+    version = db->nextChangeVersion - 1;
+    db->changeReaders[reader] = ChangeReader{version, time(0)};
+    return true;
+}
+
+bool MemoryOrderRepository::pruneChanges(long long& removed)
+{
+    TableLock guard(db->lock);
+    removed = 0;
+
+    // --------------------------------------------------
+    // Drop Readers Gone Too Long, Find The Slowest Left
+    // --------------------------------------------------
+    time_t cutoff = time(0) - (time_t)CHANGE_READER_TTL_HOURS * 3600;
+    long long horizon = db->nextChangeVersion - 1;
+    for (auto it = db->changeReaders.begin(); it != db->changeReaders.end();)
+    {
+        if (it->second.seenAt < cutoff)
+        {
+            it = db->changeReaders.erase(it);
+            continue;
+        }
+        horizon = min(horizon, it->second.version);
+        ++it;
+    }
+
+    // Every reader has read up to horizon; nothing is in flight under the table lock
+    auto end = db->orderChanges.upper_bound(horizon);
+    removed = (long long)distance(db->orderChanges.begin(), end);
+    db->orderChanges.erase(db->orderChanges.begin(), end);
+    return true;
+}
+
+bool MemoryOrderRepository::forEachOrder(const function<void(const Order&)>& visit)
+{
+    TableLock guard(db->lock);
+    for (auto it = db->ordersByDate.rbegin(); it != db->ordersByDate.rend(); ++it)
+    {
+        visit(joined(db->orders[it->second]));
+    }
+    return true;
+}
+
+// ============================================================================
+// 7/9 MemoryIssueRepository (Listing)
+// ============================================================================
+MemoryIssueRepository::MemoryIssueRepository(MemoryTables* t)
+{
+    db = t;
+}
+
+Issue MemoryIssueRepository::joined(const Issue& i)
+{
+    Issue row = i;
+    auto o = db->orders.find(i.orderId);
+    row.smartId = (o != db->orders.end()) ? o->second.smartId : "";
+    return row;
+}
+
+bool MemoryIssueRepository::listAll(vector<Issue>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    out.reserve(db->issues.size());
+    for (const auto& i : db->issues) out.push_back(joined(i.second));
+    return true;
+}
+
+bool MemoryIssueRepository::search(const string& keyword, vector<Issue>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    for (const auto& i : db->issues)
+    {
+        if (containsNoCase(i.second.issueType, keyword) || containsNoCase(i.second.resolution, keyword))
+        {
+            out.push_back(joined(i.second));
+        }
+    }
+    return true;
+}
+
+Lookup MemoryIssueRepository::find(long long id, Issue& out)
+{
+    TableLock guard(db->lock);
+    auto it = db->issues.find(id);
+    if (it == db->issues.end()) return Lookup::Missing;
+    out = joined(it->second);
+    return Lookup::Found;
+}
+
+// ============================================================================
+// 8/9 MemoryIssueRepository (Writes)
+// ============================================================================
+bool MemoryIssueRepository::updateResolution(long long id, const string& resolution)
+{
+    TableLock guard(db->lock);
+    auto it = db->issues.find(id);
+    if (it != db->issues.end()) it->second.resolution = resolution;
+    return true;
+}
+
+bool MemoryIssueRepository::remove(long long id)
+{
+    TableLock guard(db->lock);
+    auto it = db->issues.find(id);
+    if (it == db->issues.end()) return true;
+
+    eraseEntry(db->issuesByOrder, it->second.orderId, id);
+    db->issues.erase(it);
+    return true;
+}
+
+void MemoryIssueRepository::logIssue(long long orderId, const string& type, const string& resolution)
+{
+    Issue i{db->nextIssueId++, orderId, "", type, resolution, timestamp(0)};
+    db->issues[i.id] = i;
+    db->issuesByOrder.insert(make_pair(orderId, i.id));
+}
+
+bool MemoryIssueRepository::refund(long long orderId, const string& reason)
+{
+    TableLock guard(db->lock);
+    auto o = db->orders.find(orderId);
+
+    // #### Foreign Key Check ####
+    if (o == db->orders.end())
+    {
+        db->error = FK_ERROR;
+        return false;
+    }
+
+    setStatus(db, o->second, "Refunded");
+    logIssue(orderId, "Complaint", "Refund: " + reason);
+    return true;
+}
+
+bool MemoryIssueRepository::scheduleRedo(long long orderId, const string& reason, RedoTimeline& out)
+{
+    TableLock guard(db->lock);
+    auto o = db->orders.find(orderId);
+
+    // #### Foreign Key Check ####
+    if (o == db->orders.end())
+    {
+        db->error = FK_ERROR;
+        return false;
+    }
+
+    setStatus(db, o->second, "Redo In Progress");
+    o->second.expectedDate = timestamp(7);
+    logIssue(orderId, "Defect", "Redo: " + reason);
+    out = RedoTimeline{timestamp(0).substr(0, 10), timestamp(3).substr(0, 10), timestamp(7).substr(0, 10)};
+    return true;
+}
+
+// ============================================================================
+// 9/9 MemoryAdminRepository
+// ============================================================================
+MemoryAdminRepository::MemoryAdminRepository(MemoryTables* t)
+{
+    db = t;
+}
+
+Lookup MemoryAdminRepository::authenticate(const string& username, const string& password, string& role)
+{
+    TableLock guard(db->lock);
+    auto it = db->adminByUsername.find(username);
+    if (it == db->adminByUsername.end()) return Lookup::Missing;
+
+    const Admin& a = db->admins[it->second];
+    if (a.password != password) return Lookup::Missing;
+    role = a.role;
+    return Lookup::Found;
+}
+
+Lookup MemoryAdminRepository::findByUsername(const string& username, Admin& out)
+{
+    TableLock guard(db->lock);
+    auto it = db->adminByUsername.find(username);
+    if (it == db->adminByUsername.end()) return Lookup::Missing;
+    out = db->admins[it->second];
+    out.password.clear();
+    return Lookup::Found;
+}
+
+Lookup MemoryAdminRepository::find(int id, Admin& out)
+{
+    TableLock guard(db->lock);
+    auto it = db->admins.find(id);
+    if (it == db->admins.end()) return Lookup::Missing;
+    out = it->second;
+    out.password.clear();
+    return Lookup::Found;
+}
+
+bool MemoryAdminRepository::listAll(vector<Admin>& out)
+{
+    TableLock guard(db->lock);
+    out.clear();
+    for (const auto& a : db->admins)
+    {
+        out.push_back(Admin{a.second.id, a.second.username, "", a.second.role});
+    }
+    return true;
+}
+
+bool MemoryAdminRepository::add(Admin& a)
+{
+    TableLock guard(db->lock);
+
+    // The username index holds one id per name
+    if (db->adminByUsername.count(a.username) > 0)
+    {
+        db->error = "Duplicate entry '" + a.username + "' for key 'username'";
+        return false;
+    }
+
+    a.id = db->nextAdminId++;
+    db->admins[a.id] = a;
+    db->adminByUsername[a.username] = a.id;
+    return true;
+}
+
+bool MemoryAdminRepository::remove(int id)
+{
+    TableLock guard(db->lock);
+    auto it = db->admins.find(id);
+    if (it == db->admins.end()) return true;
+
+    db->adminByUsername.erase(it->second.username);
+    db->admins.erase(it);
+    return true;
+}
+
+bool MemoryAdminRepository::count(int& out)
+{
+    TableLock guard(db->lock);
+    out = (int)db->admins.size();
+    return true;
+}
\ No newline at end of file
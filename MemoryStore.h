@@ -0,0 +1,203 @@
+// ============================================================================
+// MEMORY STORE HEADER
+// ============================================================================
+#ifndef MEMORY_STORE_H
+#define MEMORY_STORE_H
+
+// Internal Headers
+#include "Repository.h"  // Repository interfaces
+
+// Standard Libraries
+#include <string>         // Keys and error text
+#include <map>            // Ordered indexes
+#include <unordered_map>  // Hash indexes
+#include <mutex>          // Table lock
+#include <tuple>          // Rollup keys
+#include <ctime>          // Change reader last-seen times
+
+using namespace std;
+
+// ============================================================================
+// DailySales
+// One daily_product_sales row: the orders of one day, product and status.
+// ============================================================================
+struct DailySales
+{
+    long long qty;
+    double revenue;
+    int orders;
+};
+
+// Change feed reader progress, as recorded by forEachChange
+struct ChangeReader
+{
+    long long version;
+    time_t seenAt;
+};
+
+// ============================================================================
+// MemoryTables
+// The four tables keyed by primary key (ordered, so listings come back in id
+// order like the MySQL engine), plus the secondary indexes the repositories
+// look up by. Every index is maintained on each write under one lock; the
+// lock is recursive so forEachOrder visitors may call back into the store.
+// ============================================================================
+struct MemoryTables
+{
+    recursive_mutex lock;
+    string error;
+
+    // #### Tables ####
+    map<int, Product> products;
+    map<long long, Order> orders;
+    map<long long, Issue> issues;
+    map<int, Admin> admins;
+
+    // #### Secondary Indexes ####
+    unordered_map<string, long long> orderBySmartId;       // smart_id (unique)
+    multimap<string, long long> ordersByDate;              // order_date, range scans for reports
+    unordered_multimap<int, long long> ordersByProduct;    // product_id (foreign key)
+    unordered_multimap<long long, long long> issuesByOrder;// order_id (foreign key)
+    unordered_map<string, int> adminByUsername;            // username
+
+    // #### Rollups ####
+    map<tuple<string, string, int>, DailySales> dailySales;  // (status, YYYY-MM-DD, product_id), report range scans
+    map<long long, long long> orderChanges;                  // Change feed: version -> order id
+    map<string, ChangeReader> changeReaders;                 // Reader name -> progress, bounds pruning
+
+    // #### Sequences ####
+    unordered_map<string, int> dailySequence;              // YYYY-MM-DD -> last smart_id sequence
+
+    // #### Auto Increment Counters ####
+    int nextProductId;
+    long long nextOrderId;
+    long long nextIssueId;
+    long long nextChangeVersion;
+    int nextAdminId;
+};
+
+// ============================================================================
+// Memory Repositories
+// Same contracts as the MySQL repositories, including the foreign key and
+// unique key failures, so modules behave identically on either engine.
+// ============================================================================
+class MemoryProductRepository : public ProductRepository
+{
+public:
+    MemoryProductRepository(MemoryTables* t);
+
+    bool listAll(vector<Product>& out) override;
+    Lookup find(int id, Product& out) override;
+    bool searchByName(const string& keyword, vector<Product>& out) override;
+    bool add(Product& p) override;
+    bool update(const Product& p) override;
+    bool remove(int id) override;
+    bool adjustStock(int id, int delta) override;
+
+private:
+    MemoryTables* db; // Shared tables
+};
+
+class MemoryOrderRepository : public OrderRepository
+{
+public:
+    MemoryOrderRepository(MemoryTables* t);
+
+    bool listAll(vector<Order>& out) override;
+    Lookup findBySmartId(const string& smartId, Order& out) override;
+    bool reserveDailySequences(int count, int& first, int& day) override;
+    bool countByProduct(int productId, int& out) override;
+    bool listByStatus(const vector<string>& statuses, vector<Order>& out) override;
+    bool listAfterId(long long afterId, vector<Order>& out) override;
+    bool insert(Order& o) override;
+    bool updateStatus(const string& smartId, const string& status) override;
+    bool remove(const string& smartId) override;
+    PlaceResult place(Order& o, bool deductStock) override;
+    PlaceResult placeBulk(const vector<Order>& orders, const map<int, int>& stockTaken) override;
+    bool browse(const OrderFilter& filter, const OrderSeek& seek, int limit, vector<Order>& out) override;
+    bool countByStatus(const OrderSelection& sel, map<string, int>& out) override;
+    bool bulkUpdateStatus(const OrderSelection& sel, const vector<string>& from, const string& to,
+                          int chunkSize, long long& updated) override;
+
+    bool salesByPeriod(const PeriodScope& scope, vector<PeriodSales>& out) override;
+    bool salesTrend(const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall) override;
+    bool extremeOrders(bool highest, int limit, vector<Order>& out) override;
+    bool rebuildSalesRollup(long long& rows) override;
+    bool verifySalesRollup(long long& mismatches) override;
+    bool forEachChange(const string& reader, long long& version, const function<void(const OrderFact&)>& visit) override;
+    bool latestChangeVersion(const string& reader, long long& version) override;
+    bool pruneChanges(long long& removed) override;
+    bool forEachOrder(const function<void(const Order&)>& visit) override;
+
+private:
+    MemoryTables* db; // Shared tables
+
+    Order joined(const Order& o);
+    bool selected(const OrderSelection& sel, const Order& o);
+};
+
+class MemoryIssueRepository : public IssueRepository
+{
+public:
+    MemoryIssueRepository(MemoryTables* t);
+
+    bool listAll(vector<Issue>& out) override;
+    bool search(const string& keyword, vector<Issue>& out) override;
+    Lookup find(long long id, Issue& out) override;
+    bool updateResolution(long long id, const string& resolution) override;
+    bool remove(long long id) override;
+    bool refund(long long orderId, const string& reason) override;
+    bool scheduleRedo(long long orderId, const string& reason, RedoTimeline& out) override;
+
+private:
+    MemoryTables* db; // Shared tables
+
+    Issue joined(const Issue& i);
+    void logIssue(long long orderId, const string& type, const string& resolution);
+};
+
+class MemoryAdminRepository : public AdminRepository
+{
+public:
+    MemoryAdminRepository(MemoryTables* t);
+
+    Lookup authenticate(const string& username, const string& password, string& role) override;
+    Lookup findByUsername(const string& username, Admin& out) override;
+    Lookup find(int id, Admin& out) override;
+    bool listAll(vector<Admin>& out) override;
+    bool add(Admin& a) override;
+    bool remove(int id) override;
+    bool count(int& out) override;
+
+private:
+    MemoryTables* db; // Shared tables
+};
+
+// ============================================================================
+// MemoryStore
+// Fully in-process DataStore for running the application (and simulations
+// with millions of orders) without a MySQL server. Starts empty;
+// seedDefaults() loads the admins and products from souvenir_system_setup.sql.
+// ============================================================================
+class MemoryStore : public DataStore
+{
+public:
+    MemoryStore();
+
+    void seedDefaults();
+
+    ProductRepository& products() override;
+    OrderRepository& orders() override;
+    IssueRepository& issues() override;
+    AdminRepository& admins() override;
+    string lastError() override;
+
+private:
+    MemoryTables tables;
+    MemoryProductRepository productRepo;
+    MemoryOrderRepository orderRepo;
+    MemoryIssueRepository issueRepo;
+    MemoryAdminRepository adminRepo;
+};
+
+#endif
\ No newline at end of file
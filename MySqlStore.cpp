@@ -0,0 +1,1575 @@
+// ============================================================================
+// MYSQL STORE IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "MySqlStore.h"
+#include "QueryMetrics.h"    // Timed query execution
+#include "StatementCache.h"  // Cached prepared statements
+#include "QueryBatch.h"      // Multi-statement round trips
+#include "ResultStream.h"    // Unbuffered row streaming
+#include "RowView.h"         // Typed zero-copy row access
+#include "Format.h"          // Day numbers for the change feed
+#include <mysqld_error.h>    // Server error codes
+
+// Standard Libraries
+#include <algorithm>   // reverse, min
+#include <cstdio>      // snprintf for prices and date ranges
+#include <random>      // Change feed reader tags
+#include <chrono>      // Change feed reader tags
+#include <ctime>       // Change feed reader tags
+
+using namespace std;
+
+// Column list shared by every order read, in orderFromRow / orderFromQuery order
+static const string ORDER_SELECT =
+    "SELECT o.id, o.smart_id, o.product_id, p.name, o.customer_name, o.address, o.quantity, o.total_price, "
+    "o.order_date, o.expected_date, o.status, o.cust_size, o.cust_color, o.cust_text "
+    "FROM orders o JOIN products p ON o.product_id = p.id";
+
+typedef RowView<long long, string_view, int, string_view, string_view, string_view, int, Money,
+                string_view, string_view, string_view, string_view, string_view, string_view> OrderRow;
+
+// Times an order transaction is run before a deadlock / lost session is reported
+static const int PLACE_ATTEMPTS = 3;
+
+// Bulk placement: rows per multi-row INSERT (well under max_allowed_packet)
+static const size_t BULK_INSERT_ROWS = 1000;
+
+// Change feed: AUTO_INCREMENT hands versions out at insert time, so a transaction
+// still open during a read can later commit a version below the one read up to.
+// Its changed_at is then at most this long before the read started (no write
+// transaction stays open longer: they are capped at MAX_ORDERS_PER_TRANSACTION
+// orders), so each read re-reads the changes stamped that close to the reader's
+// previous read as well (facts are idempotent). An idle feed re-reads nothing.
+static const int FEED_REPLAY_SECONDS = 120;
+
+// Change feed reader names carry a per-process tag, so the same reader on two
+// terminals keeps two watermarks
+static string readerName(const string& reader)
+{
+    static const string tag = []()
+    {
+        // random_device alone is deterministic on some MinGW builds, so the clocks are mixed in
+        random_device rd;
+        unsigned long long mix = ((unsigned long long)rd() << 32) ^ (unsigned long long)time(0) ^
+                                 (unsigned long long)chrono::steady_clock::now().time_since_epoch().count();
+        char buf[17];
+        snprintf(buf, sizeof(buf), "%016llx", mix);
+        return string(buf);
+    }();
+    return reader + "@" + tag;
+}
+
+// Deadlock or lock wait timeout: InnoDB rolled the transaction back
+static bool lockConflict(MYSQL* conn)
+{
+    unsigned int code = mysql_errno(conn);
+    return code == ER_LOCK_DEADLOCK || code == ER_LOCK_WAIT_TIMEOUT;
+}
+
+// Escaped, single-quoted SQL literal
+static string quoteText(MYSQL* conn, const string& text)
+{
+    vector<char> escaped(text.length() * 2 + 1);
+    unsigned long n = mysql_real_escape_string(conn, escaped.data(), text.c_str(), text.length());
+    return "'" + string(escaped.data(), n) + "'";
+}
+
+// WHERE predicates for a bulk selection; an id list contributes entries [idFrom, idTo)
+static string selectionWhere(MYSQL* conn, const OrderSelection& sel, size_t idFrom, size_t idTo)
+{
+    if (!sel.smartIds.empty())
+    {
+        string in;
+        for (size_t i = idFrom; i < idTo; i++)
+        {
+            in += (i > idFrom ? "," : "") + quoteText(conn, sel.smartIds[i]);
+        }
+        return "smart_id IN (" + in + ")";
+    }
+
+    string where = "1=1";
+    if (!sel.filter.status.empty())   where += " AND status = " + quoteText(conn, sel.filter.status);
+    if (!sel.filter.fromDate.empty()) where += " AND order_date >= " + quoteText(conn, sel.filter.fromDate);
+    if (!sel.filter.toDate.empty())   where += " AND order_date < DATE_ADD(" + quoteText(conn, sel.filter.toDate) + ", INTERVAL 1 DAY)";
+    if (sel.productId != 0)           where += " AND product_id = " + to_string(sel.productId);
+    return where;
+}
+
+// ============================================================================
+// 1/9 Row Decoding Helpers
+// ============================================================================
+static Order orderFromRow(MYSQL_ROW row, unsigned long* lengths)
+{
+    OrderRow r(row, lengths);
+    Order o;
+    o.id = r.get<0>();
+    o.smartId = string(r.get<1>());
+    o.productId = r.get<2>();
+    o.productName = string(r.get<3>());
+    o.customerName = string(r.get<4>());
+    o.address = string(r.get<5>());
+    o.quantity = r.get<6>();
+    o.totalPrice = r.get<7>().toDouble();
+    o.orderDate = string(r.get<8>());
+    o.expectedDate = string(r.get<9>());
+    o.status = string(r.get<10>());
+    o.custSize = string(r.get<11>());
+    o.custColor = string(r.get<12>());
+    o.custText = string(r.get<13>());
+    return o;
+}
+
+static Order orderFromQuery(PreparedQuery& q)
+{
+    Order o;
+    o.id = q.getInt(0);
+    o.smartId = q.getString(1);
+    o.productId = (int)q.getInt(2);
+    o.productName = q.getString(3);
+    o.customerName = q.getString(4);
+    o.address = q.getString(5);
+    o.quantity = (int)q.getInt(6);
+    o.totalPrice = q.getDouble(7);
+    o.orderDate = q.getString(8);
+    o.expectedDate = q.getString(9);
+    o.status = q.getString(10);
+    o.custSize = q.getString(11);
+    o.custColor = q.getString(12);
+    o.custText = q.getString(13);
+    return o;
+}
+
+static Issue issueFromRow(MYSQL_ROW row, unsigned long* lengths)
+{
+    RowView<long long, long long, string_view, string_view, string_view, string_view> r(row, lengths);
+    Issue i;
+    i.id = r.get<0>();
+    i.orderId = r.get<1>();
+    i.smartId = string(r.get<2>());
+    i.issueType = string(r.get<3>());
+    i.resolution = string(r.get<4>());
+    i.logDate = string(r.get<5>());
+    return i;
+}
+
+// ============================================================================
+// 2/9 bestWorst
+// Best and worst sellers (by units) from per-item totals. Ties go to the
+// first name, as in the memory engine.
+// ============================================================================
+static pair<ItemQty, ItemQty> bestWorst(const map<string, long long>& units)
+{
+    pair<ItemQty, ItemQty> items(ItemQty{"-", 0}, ItemQty{"-", 0});
+    bool first = true;
+    for (const pair<const string, long long>& u : units)
+    {
+        if (first || u.second > items.first.qty)  items.first = ItemQty{u.first, u.second};
+        if (first || u.second < items.second.qty) items.second = ItemQty{u.first, u.second};
+        first = false;
+    }
+    return items;
+}
+
+// ============================================================================
+// 3/9 MySqlStore / BatchConnection
+// ============================================================================
+MySqlStore::MySqlStore(MYSQL* c, DatabaseConnection* pool)
+    : batchConn(pool), productRepo(c, &error), orderRepo(c, &batchConn, &error), issueRepo(c, &batchConn, &error),
+      adminRepo(c, &error)
+{
+}
+
+BatchConnection::BatchConnection(DatabaseConnection* p)
+{
+    pool = p;
+}
+
+MYSQL* BatchConnection::get(string* error)
+{
+    if (!lease.get() && pool)
+    {
+        lease = pool->acquireBatch();
+    }
+
+    // #### Lease Check ####
+    if (!lease.get())
+    {
+        *error = "Database unavailable.";
+        return nullptr;
+    }
+    return lease.get();
+}
+
+ProductRepository& MySqlStore::products() { return productRepo; }
+OrderRepository& MySqlStore::orders() { return orderRepo; }
+IssueRepository& MySqlStore::issues() { return issueRepo; }
+AdminRepository& MySqlStore::admins() { return adminRepo; }
+string MySqlStore::lastError() { return error; }
+
+// ============================================================================
+// 4/9 MySqlProductRepository (Listing)
+// ============================================================================
+MySqlProductRepository::MySqlProductRepository(MYSQL* c, string* err)
+{
+    conn = c;
+    error = err;
+}
+
+bool MySqlProductRepository::listAll(vector<Product>& out)
+{
+    QueryExecutor::read(conn, "SELECT id, name, type, price, stock_quantity, production_hours FROM products", "MySqlProductRepository::listAll");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+
+    // #### Query Failure Check ####
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.clear();
+    out.reserve(mysql_num_rows(res));
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        RowView<int, string_view, string_view, Money, int, int> r(row, mysql_fetch_lengths(res));
+        out.push_back(Product{r.get<0>(), string(r.get<1>()), string(r.get<2>()), r.get<3>().toDouble(), r.get<4>(), r.get<5>()});
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+Lookup MySqlProductRepository::find(int id, Product& out)
+{
+    PreparedQuery q(conn, "SELECT name, type, price, stock_quantity, production_hours FROM products WHERE id=?", "MySqlProductRepository::find");
+    q.markIdempotent();
+    q.bindInt(0, id);
+
+    // #### Query Failure Check ####
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+
+    out = Product{id, q.getString(0), q.getString(1), q.getDouble(2), (int)q.getInt(3), (int)q.getInt(4)};
+    return Lookup::Found;
+}
+
+bool MySqlProductRepository::searchByName(const string& keyword, vector<Product>& out)
+{
+    PreparedQuery q(conn, "SELECT id, name, type, price, stock_quantity, production_hours FROM products WHERE name LIKE ?", "MySqlProductRepository::searchByName");
+    q.markIdempotent();
+    q.bindString(0, "%" + keyword + "%");
+
+    // #### Query Failure Check ####
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+
+    out.clear();
+    while (q.fetch())
+    {
+        out.push_back(Product{(int)q.getInt(0), q.getString(1), q.getString(2), q.getDouble(3), (int)q.getInt(4), (int)q.getInt(5)});
+    }
+    return true;
+}
+
+// ============================================================================
+// 5/9 MySqlProductRepository (Writes)
+// ============================================================================
+bool MySqlProductRepository::add(Product& p)
+{
+    PreparedQuery q(conn, "INSERT INTO products (name, type, price, stock_quantity, production_hours) VALUES (?, ?, ?, ?, ?)", "MySqlProductRepository::add");
+    q.bindString(0, p.name);
+    q.bindString(1, p.type);
+    q.bindDouble(2, p.price);
+    q.bindInt(3, p.stock);
+    q.bindInt(4, p.productionHours);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    p.id = (int)mysql_insert_id(conn);
+    return true;
+}
+
+bool MySqlProductRepository::update(const Product& p)
+{
+    PreparedQuery q(conn, "UPDATE products SET name=?, type=?, price=?, stock_quantity=?, production_hours=? WHERE id=?", "MySqlProductRepository::update");
+    q.bindString(0, p.name);
+    q.bindString(1, p.type);
+    q.bindDouble(2, p.price);
+    q.bindInt(3, p.stock);
+    q.bindInt(4, p.productionHours);
+    q.bindInt(5, p.id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlProductRepository::remove(int id)
+{
+    PreparedQuery q(conn, "DELETE FROM products WHERE id=?", "MySqlProductRepository::remove");
+    q.bindInt(0, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlProductRepository::adjustStock(int id, int delta)
+{
+    PreparedQuery q(conn, "UPDATE products SET stock_quantity = stock_quantity + ? WHERE id=?", "MySqlProductRepository::adjustStock");
+    q.bindInt(0, delta);
+    q.bindInt(1, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// 6/9 MySqlOrderRepository (Orders)
+// ============================================================================
+MySqlOrderRepository::MySqlOrderRepository(MYSQL* c, BatchConnection* b, string* err)
+{
+    conn = c;
+    batchConn = b;
+    error = err;
+}
+
+bool MySqlOrderRepository::listAll(vector<Order>& out)
+{
+    QueryExecutor::read(conn, ORDER_SELECT + " ORDER BY o.id", "MySqlOrderRepository::listAll");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+
+    // #### Query Failure Check ####
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.clear();
+    out.reserve(mysql_num_rows(res));
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        out.push_back(orderFromRow(row, mysql_fetch_lengths(res)));
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+Lookup MySqlOrderRepository::findBySmartId(const string& smartId, Order& out)
+{
+    PreparedQuery q(conn, ORDER_SELECT + " WHERE o.smart_id=?", "MySqlOrderRepository::findBySmartId");
+    q.markIdempotent();
+    q.bindString(0, smartId);
+
+    // #### Query Failure Check ####
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+
+    out = orderFromQuery(q);
+    return Lookup::Found;
+}
+
+bool MySqlOrderRepository::reserveDailySequences(int count, int& first, int& day)
+{
+    const char* site = "MySqlOrderRepository::reserveDailySequences";
+
+    // --------------------------------------------------
+    // Fix The Counter Date On The Server's Clock
+    // --------------------------------------------------
+    // Read once and then named in the upsert, so the counter row and the date in the smart_id
+    // are the same day even when the statement runs across midnight
+    QueryExecutor::read(conn, "SELECT CURDATE()", site);
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+    MYSQL_ROW row = mysql_fetch_row(res);
+    Date today = row ? RowView<Date>(row, mysql_fetch_lengths(res)).get<0>() : Date{0, 0, 0};
+    mysql_free_result(res);
+
+    // #### Server Date Check ####
+    if (today.year == 0)
+    {
+        *error = "Server returned no current date.";
+        return false;
+    }
+    day = Format::dayNumber(today.year, today.month, today.day);
+    char date[Format::DATE_LEN + 1];
+    Format::writeDay(date, day);
+
+    // One autocommitted upsert on that day's counter row: the row lock is held only for this statement,
+    // and LAST_INSERT_ID(expr) hands the new high mark back to this session alone
+    string n = to_string(count);
+    int rc = QueryExecutor::run(conn,
+        string("INSERT INTO order_sequences (seq_date, last_seq) VALUES ('") + date + "', LAST_INSERT_ID(" + n + ")) "
+        "ON DUPLICATE KEY UPDATE last_seq = LAST_INSERT_ID(last_seq + " + n + ")",
+        site);
+    if (rc != 0)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+    first = (int)mysql_insert_id(conn) - count + 1;
+    return true;
+}
+
+bool MySqlOrderRepository::countByProduct(int productId, int& out)
+{
+    PreparedQuery q(conn, "SELECT COUNT(*) FROM orders WHERE product_id=?", "MySqlOrderRepository::countByProduct");
+    q.markIdempotent();
+    q.bindInt(0, productId);
+
+    if (!q.execute() || !q.fetch())
+    {
+        *error = q.error();
+        return false;
+    }
+    out = (int)q.getInt(0);
+    return true;
+}
+
+bool MySqlOrderRepository::listByStatus(const vector<string>& statuses, vector<Order>& out)
+{
+    out.clear();
+    if (statuses.empty())
+    {
+        return true;
+    }
+
+    // Served by the (status, order_date) index
+    string in;
+    for (const string& s : statuses)
+    {
+        in += (in.empty() ? "" : ",") + quoteText(conn, s);
+    }
+    QueryExecutor::read(conn, ORDER_SELECT + " WHERE o.status IN (" + in + ") ORDER BY o.order_date, o.id",
+                        "MySqlOrderRepository::listByStatus");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+
+    // #### Query Failure Check ####
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.reserve(mysql_num_rows(res));
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        out.push_back(orderFromRow(row, mysql_fetch_lengths(res)));
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+bool MySqlOrderRepository::listAfterId(long long afterId, vector<Order>& out)
+{
+    PreparedQuery q(conn, ORDER_SELECT + " WHERE o.id > ? ORDER BY o.id", "MySqlOrderRepository::listAfterId");
+    q.markIdempotent();
+    q.bindInt(0, afterId);
+
+    // #### Query Failure Check ####
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+
+    out.clear();
+    while (q.fetch())
+    {
+        out.push_back(orderFromQuery(q));
+    }
+    return true;
+}
+
+bool MySqlOrderRepository::insert(Order& o)
+{
+    bool transient = false;
+    return insertRow(o, transient);
+}
+
+bool MySqlOrderRepository::insertRow(Order& o, bool& transient)
+{
+    // order_date falls back to the column default (now) unless the caller supplies one
+    string sql = o.orderDate.empty()
+        ? "INSERT INTO orders (smart_id, product_id, customer_name, address, quantity, total_price, expected_date, status, cust_size, cust_color, cust_text) "
+          "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
+        : "INSERT INTO orders (smart_id, product_id, customer_name, address, quantity, total_price, expected_date, status, cust_size, cust_color, cust_text, order_date) "
+          "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+
+    PreparedQuery q(conn, sql, "MySqlOrderRepository::insert");
+    q.bindString(0, o.smartId);
+    q.bindInt(1, o.productId);
+    q.bindString(2, o.customerName);
+    q.bindString(3, o.address);
+    q.bindInt(4, o.quantity);
+    q.bindDouble(5, o.totalPrice);
+    q.bindString(6, o.expectedDate);
+    q.bindString(7, o.status);
+    q.bindString(8, o.custSize);
+    q.bindString(9, o.custColor);
+    q.bindString(10, o.custText);
+    if (!o.orderDate.empty())
+    {
+        q.bindString(11, o.orderDate);
+    }
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        transient = q.transient();
+        return false;
+    }
+    o.id = (long long)mysql_insert_id(conn);
+    return true;
+}
+
+bool MySqlOrderRepository::updateStatus(const string& smartId, const string& status)
+{
+    PreparedQuery q(conn, "UPDATE orders SET status=? WHERE smart_id=?", "MySqlOrderRepository::updateStatus");
+    q.bindString(0, status);
+    q.bindString(1, smartId);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlOrderRepository::remove(const string& smartId)
+{
+    PreparedQuery q(conn, "DELETE FROM orders WHERE smart_id=?", "MySqlOrderRepository::remove");
+    q.bindString(0, smartId);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+PlaceResult MySqlOrderRepository::place(Order& o, bool deductStock)
+{
+    // A deadlock or dropped session has already undone the whole transaction, so it is re-run from the top
+    for (int attempt = 1; attempt <= PLACE_ATTEMPTS; attempt++)
+    {
+        bool transient = false;
+        PlaceResult result = placeOnce(o, deductStock, transient);
+        if (result != PlaceResult::Failed || !transient)
+        {
+            return result;
+        }
+    }
+    return PlaceResult::Failed;
+}
+
+PlaceResult MySqlOrderRepository::placeOnce(Order& o, bool deductStock, bool& transient)
+{
+    const char* site = "MySqlOrderRepository::place";
+
+    if (QueryExecutor::run(conn, "START TRANSACTION", site) != 0)
+    {
+        *error = QueryExecutor::errorText(conn);
+        transient = QueryExecutor::isRetryable(conn);
+        return PlaceResult::Failed;
+    }
+
+    // #### Conditional Decrement ####
+    // Locks the product row; when another clerk took the last units first, no row matches
+    if (deductStock)
+    {
+        PreparedQuery dec(conn, "UPDATE products SET stock_quantity = stock_quantity - ? WHERE id=? AND stock_quantity >= ?", site);
+        dec.bindInt(0, o.quantity);
+        dec.bindInt(1, o.productId);
+        dec.bindInt(2, o.quantity);
+
+        if (!dec.execute())
+        {
+            *error = dec.error();
+            transient = dec.transient();
+            QueryExecutor::run(conn, "ROLLBACK", site);
+            return PlaceResult::Failed;
+        }
+        if (dec.affectedRows() == 0)
+        {
+            QueryExecutor::run(conn, "ROLLBACK", site);
+            return PlaceResult::OutOfStock;
+        }
+    }
+
+    if (!insertRow(o, transient))
+    {
+        QueryExecutor::run(conn, "ROLLBACK", site);
+        return PlaceResult::Failed;
+    }
+    return commitOrders(conn, o.smartId, transient);
+}
+
+PlaceResult MySqlOrderRepository::commitOrders(MYSQL* tx, const string& probeSmartId, bool& transient)
+{
+    // tx is the connection that holds the open transaction
+    const char* site = "MySqlOrderRepository::commit";
+
+    if (QueryExecutor::run(tx, "COMMIT", site) != 0)
+    {
+        *error = QueryExecutor::errorText(tx);
+
+        // #### Unknown Outcome Check ####
+        // The session dropped during COMMIT: the orders went in only if one of their smart_ids is there now
+        if (QueryExecutor::isRetryable(tx))
+        {
+            Order existing;
+            Lookup found = findBySmartId(probeSmartId, existing);
+            if (found == Lookup::Found)
+            {
+                return PlaceResult::Placed;
+            }
+            transient = (found == Lookup::Missing);
+        }
+        else
+        {
+            transient = lockConflict(tx);
+            QueryExecutor::run(tx, "ROLLBACK", site);
+        }
+        return PlaceResult::Failed;
+    }
+    return PlaceResult::Placed;
+}
+
+PlaceResult MySqlOrderRepository::placeBulk(const vector<Order>& orders, const map<int, int>& stockTaken)
+{
+    if (orders.empty())
+    {
+        return PlaceResult::Placed;
+    }
+
+    for (int attempt = 1; attempt <= PLACE_ATTEMPTS; attempt++)
+    {
+        bool transient = false;
+        PlaceResult result = placeBulkOnce(orders, stockTaken, transient);
+        if (result != PlaceResult::Failed || !transient)
+        {
+            return result;
+        }
+    }
+    return PlaceResult::Failed;
+}
+
+PlaceResult MySqlOrderRepository::placeBulkOnce(const vector<Order>& orders, const map<int, int>& stockTaken, bool& transient)
+{
+    // Transaction start, decrements and inserts in one round trip; COMMIT only once every decrement matched
+    MYSQL* tx = batchConn->get(error);
+    if (!tx)
+    {
+        return PlaceResult::Failed;
+    }
+    QueryBatch batch(tx, "MySqlOrderRepository::placeBulk");
+    batch.add("START TRANSACTION");
+
+    vector<size_t> decrements;
+    for (const pair<const int, int>& t : stockTaken)
+    {
+        string units = to_string(t.second);
+        decrements.push_back(batch.add("UPDATE products SET stock_quantity = stock_quantity - " + units +
+                                       " WHERE id=" + to_string(t.first) + " AND stock_quantity >= " + units));
+    }
+
+    for (size_t start = 0; start < orders.size(); start += BULK_INSERT_ROWS)
+    {
+        string sql = "INSERT INTO orders (smart_id, product_id, customer_name, address, quantity, total_price, expected_date, status, cust_size, cust_color, cust_text) VALUES ";
+        size_t end = min(orders.size(), start + BULK_INSERT_ROWS);
+        for (size_t i = start; i < end; i++)
+        {
+            const Order& o = orders[i];
+            char total[32];
+            snprintf(total, sizeof(total), "%.2f", o.totalPrice);
+
+            sql += (i > start ? ",(" : "(");
+            sql += batch.quote(o.smartId) + "," + to_string(o.productId) + "," + batch.quote(o.customerName) + "," +
+                   batch.quote(o.address) + "," + to_string(o.quantity) + "," + total + "," +
+                   batch.quote(o.expectedDate) + "," + batch.quote(o.status.empty() ? "Pending" : o.status) + "," +
+                   batch.quote(o.custSize) + "," + batch.quote(o.custColor) + "," + batch.quote(o.custText) + ")";
+        }
+        batch.add(sql);
+    }
+
+    if (!batch.execute())
+    {
+        *error = batch.error();
+        transient = QueryExecutor::isRetryable(tx) || lockConflict(tx);
+        QueryExecutor::run(tx, "ROLLBACK", "MySqlOrderRepository::placeBulk");
+        return PlaceResult::Failed;
+    }
+
+    // #### Stock Check ####
+    for (size_t idx : decrements)
+    {
+        if (batch.affectedRows(idx) == 0)
+        {
+            QueryExecutor::run(tx, "ROLLBACK", "MySqlOrderRepository::placeBulk");
+            return PlaceResult::OutOfStock;
+        }
+    }
+    return commitOrders(tx, orders.front().smartId, transient);
+}
+
+bool MySqlOrderRepository::browse(const OrderFilter& filter, const OrderSeek& seek, int limit, vector<Order>& out)
+{
+    // Filters and the seek key are plain range predicates, so a page is one index range read of limit rows
+    bool seeking = !seek.orderDate.empty();
+    string sql = ORDER_SELECT + " WHERE 1=1";
+    if (!filter.status.empty())   sql += " AND o.status = ?";
+    if (!filter.fromDate.empty()) sql += " AND o.order_date >= ?";
+    if (!filter.toDate.empty())   sql += " AND o.order_date < DATE_ADD(?, INTERVAL 1 DAY)";
+    if (seeking)
+    {
+        sql += seek.older ? " AND (o.order_date < ? OR (o.order_date = ? AND o.id < ?))"
+                          : " AND (o.order_date > ? OR (o.order_date = ? AND o.id > ?))";
+    }
+
+    // A previous page is read upwards from the key and flipped below
+    bool upwards = seeking && !seek.older;
+    sql += upwards ? " ORDER BY o.order_date ASC, o.id ASC LIMIT ?" : " ORDER BY o.order_date DESC, o.id DESC LIMIT ?";
+
+    PreparedQuery q(conn, sql, "MySqlOrderRepository::browse");
+    q.markIdempotent();
+    int idx = 0;
+    if (!filter.status.empty())   q.bindString(idx++, filter.status);
+    if (!filter.fromDate.empty()) q.bindString(idx++, filter.fromDate);
+    if (!filter.toDate.empty())   q.bindString(idx++, filter.toDate);
+    if (seeking)
+    {
+        q.bindString(idx++, seek.orderDate);
+        q.bindString(idx++, seek.orderDate);
+        q.bindInt(idx++, seek.id);
+    }
+    q.bindInt(idx, limit);
+
+    // #### Query Failure Check ####
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+
+    out.clear();
+    while (q.fetch())
+    {
+        out.push_back(orderFromQuery(q));
+    }
+    if (upwards)
+    {
+        reverse(out.begin(), out.end());
+    }
+    return true;
+}
+
+bool MySqlOrderRepository::countByStatus(const OrderSelection& sel, map<string, int>& out)
+{
+    out.clear();
+
+    // An id list is counted in slices so no single IN list grows unbounded
+    size_t total = sel.smartIds.empty() ? 1 : sel.smartIds.size();
+    for (size_t start = 0; start < total; start += BULK_INSERT_ROWS)
+    {
+        size_t end = min(total, start + BULK_INSERT_ROWS);
+        QueryExecutor::read(conn, "SELECT status, COUNT(*) FROM orders WHERE " + selectionWhere(conn, sel, start, end) + " GROUP BY status",
+                            "MySqlOrderRepository::countByStatus");
+        MYSQL_RES* res = QueryExecutor::store(conn);
+
+        // #### Query Failure Check ####
+        if (!res)
+        {
+            *error = QueryExecutor::errorText(conn);
+            return false;
+        }
+
+        MYSQL_ROW row;
+        while ((row = mysql_fetch_row(res)))
+        {
+            RowView<string_view, int> r(row, mysql_fetch_lengths(res));
+            out[string(r.get<0>())] += r.get<1>();
+        }
+        mysql_free_result(res);
+    }
+    return true;
+}
+
+bool MySqlOrderRepository::bulkUpdateStatus(const OrderSelection& sel, const vector<string>& from, const string& to,
+                                            int chunkSize, long long& updated)
+{
+    const char* site = "MySqlOrderRepository::bulkUpdateStatus";
+    updated = 0;
+    if (from.empty() || chunkSize <= 0)
+    {
+        return true;
+    }
+    chunkSize = min(chunkSize, MAX_ORDERS_PER_TRANSACTION);
+
+    string sources;
+    for (size_t i = 0; i < from.size(); i++)
+    {
+        sources += (i ? "," : "") + quoteText(conn, from[i]);
+    }
+    string update = "UPDATE orders SET status = " + quoteText(conn, to) + " WHERE status IN (" + sources + ") AND ";
+
+    // Each chunk is its own autocommitted statement. Re-running one is safe:
+    // rows it already changed left the source statuses and no longer match.
+    auto runChunk = [&](const string& sql, long long& affected) -> bool
+    {
+        for (int attempt = 1; attempt <= PLACE_ATTEMPTS; attempt++)
+        {
+            if (QueryExecutor::read(conn, sql, site) == 0)
+            {
+                affected = (long long)mysql_affected_rows(conn);
+                return true;
+            }
+            if (!lockConflict(conn))
+            {
+                break;
+            }
+        }
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    };
+
+    long long affected = 0;
+    if (!sel.smartIds.empty())
+    {
+        for (size_t start = 0; start < sel.smartIds.size(); start += chunkSize)
+        {
+            size_t end = min(sel.smartIds.size(), start + chunkSize);
+            if (!runChunk(update + selectionWhere(conn, sel, start, end), affected))
+            {
+                return false;
+            }
+            updated += affected;
+        }
+        return true;
+    }
+
+    // Filtered selections take chunkSize rows at a time until a short chunk shows nothing is left
+    string sql = update + selectionWhere(conn, sel, 0, 0) + " ORDER BY id LIMIT " + to_string(chunkSize);
+    do
+    {
+        if (!runChunk(sql, affected))
+        {
+            return false;
+        }
+        updated += affected;
+    } while (affected == chunkSize);
+    return true;
+}
+
+// ============================================================================
+// 7/9 MySqlOrderRepository (Sales Reports)
+// ============================================================================
+bool MySqlOrderRepository::salesByPeriod(const PeriodScope& scope, vector<PeriodSales>& out)
+{
+    pair<ItemQty, ItemQty> overall;
+    return salesTrend(scope, out, overall);
+}
+
+bool MySqlOrderRepository::salesTrend(const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall)
+{
+    // --------------------------------------------------
+    // Period Key And Scope Filter
+    // --------------------------------------------------
+    string key;
+    if (scope.unit == Period::Day)        key = "DATE_FORMAT(d.sale_date, '%Y-%m-%d')";
+    else if (scope.unit == Period::Week)  key = "FLOOR((DAY(d.sale_date)-1)/7)+1";
+    else if (scope.unit == Period::Month) key = "DATE_FORMAT(d.sale_date, '%Y-%m')";
+    else                                  key = "DATE_FORMAT(d.sale_date, '%Y')";
+
+    // A year (or year and month) is a sale_date range on the (status, sale_date) index
+    string filter = "d.status = 'Completed'";
+    if (scope.year > 0)
+    {
+        bool oneMonth = scope.month > 0;
+        int fromMonth = oneMonth ? scope.month : 1;
+        int toYear = (oneMonth && scope.month < 12) ? scope.year : scope.year + 1;
+        int toMonth = oneMonth ? scope.month % 12 + 1 : 1;
+        char range[96];
+        snprintf(range, sizeof(range), " AND d.sale_date >= '%04d-%02d-01' AND d.sale_date < '%04d-%02d-01'",
+                 scope.year, fromMonth, toYear, toMonth);
+        filter += range;
+    }
+    else if (scope.month > 0)
+    {
+        filter += " AND MONTH(d.sale_date) = " + to_string(scope.month);
+    }
+
+    // One row per (period, item) from the day rollup: revenue, best and worst all reduce from the same result
+    string q = "SELECT " + key + " AS period, p.name, SUM(d.qty), SUM(d.revenue) "
+               "FROM daily_product_sales d JOIN products p ON d.product_id = p.id WHERE " + filter +
+               " GROUP BY period, p.name ORDER BY period " + (scope.newestFirst ? "DESC" : "ASC") + ", p.name";
+
+    QueryExecutor::read(conn, q, "MySqlOrderRepository::salesByPeriod");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    // --------------------------------------------------
+    // Reduce Item Rows Into Periods And Overall Totals
+    // --------------------------------------------------
+    // Items arrive by name within a period, so ties go to the first name (as the memory engine does)
+    out.clear();
+    map<string, long long> units;   // Item -> units over every period in scope
+    string period;                  // Period of the previous row
+    bool shown = false;             // Previous row's period is within the limit
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        RowView<string_view, string_view, long long, Money> r(row, mysql_fetch_lengths(res));
+        long long qty = r.get<2>();
+        units[string(r.get<1>())] += qty;
+
+        bool opens = out.empty() || period != r.get<0>();
+        if (opens)
+        {
+            // #### Period Limit Check ####
+            // Periods past the limit still count towards the overall items
+            period = string(r.get<0>());
+            shown = scope.limit <= 0 || (int)out.size() < scope.limit;
+            if (shown) out.push_back(PeriodSales{period, 0.0, ItemQty{"-", 0}, ItemQty{"-", 0}});
+        }
+        if (!shown) continue;
+
+        PeriodSales& s = out.back();
+        s.revenue += r.get<3>().toDouble();
+        if (opens || qty > s.best.qty)  s.best = ItemQty{string(r.get<1>()), qty};
+        if (opens || qty < s.worst.qty) s.worst = ItemQty{string(r.get<1>()), qty};
+    }
+    mysql_free_result(res);
+    overall = bestWorst(units);
+    return true;
+}
+
+bool MySqlOrderRepository::extremeOrders(bool highest, int limit, vector<Order>& out)
+{
+    string q = ORDER_SELECT + " WHERE o.status = 'Completed' ORDER BY o.total_price " + (highest ? "DESC" : "ASC") + " LIMIT " + to_string(limit);
+    QueryExecutor::read(conn, q, "MySqlOrderRepository::extremeOrders");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.clear();
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        out.push_back(orderFromRow(row, mysql_fetch_lengths(res)));
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+// Orders grouped the way daily_product_sales keys them
+static const string ROLLUP_FROM_ORDERS =
+    "SELECT DATE(order_date) AS sale_date, product_id, IFNULL(status, '') AS status, "
+    "SUM(quantity) AS qty, SUM(total_price) AS revenue, COUNT(*) AS order_count "
+    "FROM orders GROUP BY DATE(order_date), product_id, IFNULL(status, '')";
+
+bool MySqlOrderRepository::rebuildSalesRollup(long long& rows)
+{
+    // Emptied and refilled in one transaction, so reports never see it half built
+    MYSQL* tx = batchConn->get(error);
+    if (!tx)
+    {
+        return false;
+    }
+    QueryBatch batch(tx, "MySqlOrderRepository::rebuildSalesRollup");
+    batch.add("START TRANSACTION");
+    batch.add("DELETE FROM daily_product_sales");
+    size_t fill = batch.add("INSERT INTO daily_product_sales (sale_date, product_id, status, qty, revenue, order_count) " +
+                            ROLLUP_FROM_ORDERS);
+    batch.add("COMMIT");
+
+    if (!batch.execute())
+    {
+        *error = batch.error();
+        QueryExecutor::run(tx, "ROLLBACK", "MySqlOrderRepository::rebuildSalesRollup");
+        return false;
+    }
+    rows = (long long)batch.affectedRows(fill);
+    return true;
+}
+
+bool MySqlOrderRepository::verifySalesRollup(long long& mismatches)
+{
+    // Rollup rows that are wrong or stale, plus (day, product, status) groups missing from it
+    string q = "SELECT "
+               "(SELECT COUNT(*) FROM daily_product_sales d LEFT JOIN (" + ROLLUP_FROM_ORDERS + ") o "
+               "ON o.sale_date = d.sale_date AND o.product_id = d.product_id AND o.status = d.status "
+               "WHERE o.order_count IS NULL OR o.qty <> d.qty OR o.revenue <> d.revenue OR o.order_count <> d.order_count) + "
+               "(SELECT COUNT(*) FROM (" + ROLLUP_FROM_ORDERS + ") o LEFT JOIN daily_product_sales d "
+               "ON d.sale_date = o.sale_date AND d.product_id = o.product_id AND d.status = o.status "
+               "WHERE d.sale_date IS NULL)";
+
+    QueryExecutor::read(conn, q, "MySqlOrderRepository::verifySalesRollup");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    MYSQL_ROW row = mysql_fetch_row(res);
+    mismatches = row ? RowView<long long>(row, mysql_fetch_lengths(res)).get<0>() : 0;
+    mysql_free_result(res);
+    return true;
+}
+
+bool MySqlOrderRepository::readChangeHead(long long& head)
+{
+    QueryExecutor::read(conn, "SELECT IFNULL(MAX(version), 0) FROM order_changes", "MySqlOrderRepository::readChangeHead");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+    MYSQL_ROW row = mysql_fetch_row(res);
+    head = row ? RowView<long long>(row, mysql_fetch_lengths(res)).get<0>() : 0;
+    mysql_free_result(res);
+    return true;
+}
+
+bool MySqlOrderRepository::recordReader(const string& reader, long long version,
+                                        chrono::steady_clock::time_point readStart, bool& known)
+{
+    // seen_at is when the read started (a second early, for DATETIME truncation): the next read replays from it
+    long long secondsAgo = chrono::duration_cast<chrono::seconds>(chrono::steady_clock::now() - readStart).count() + 1;
+    PreparedQuery q(conn, "INSERT INTO change_readers (reader, version, seen_at) VALUES (?, ?, NOW() - INTERVAL ? SECOND) "
+                          "ON DUPLICATE KEY UPDATE version = VALUES(version), seen_at = VALUES(seen_at)",
+                    "MySqlOrderRepository::recordReader");
+    q.bindString(0, readerName(reader));
+    q.bindInt(1, version);
+    q.bindInt(2, secondsAgo);
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+
+    // 1 = inserted, so there was no row for this reader; 2 (or 0 when unchanged) = updated
+    known = q.affectedRows() != 1;
+    return true;
+}
+
+bool MySqlOrderRepository::forEachChange(const string& reader, long long& version, const function<void(const OrderFact&)>& visit)
+{
+    const char* site = "MySqlOrderRepository::forEachChange";
+    chrono::steady_clock::time_point readStart = chrono::steady_clock::now();
+    bool fullLoad = version == 0;
+
+    // --------------------------------------------------
+    // Full Load: Head And Rows From One Snapshot
+    // --------------------------------------------------
+    // Changes committed after the snapshot have versions above its head, or were stamped within
+    // FEED_REPLAY_SECONDS of its start, so the next read replays them
+    long long head = version;
+    string q;
+    if (fullLoad)
+    {
+        if (QueryExecutor::run(conn, "START TRANSACTION WITH CONSISTENT SNAPSHOT, READ ONLY", site) != 0)
+        {
+            *error = QueryExecutor::errorText(conn);
+            return false;
+        }
+        if (!readChangeHead(head))
+        {
+            QueryExecutor::run(conn, "ROLLBACK", site);
+            return false;
+        }
+        q = "SELECT 0, id, 0, DATE(order_date), product_id, quantity, total_price, IFNULL(status, '') FROM orders ORDER BY id";
+    }
+    else
+    {
+        // Changes past the watermark, plus any stamped within the replay window of the previous
+        // read (the changed_at index finds the oldest); latest change per order, and a missing
+        // order row means it was deleted
+        string after = to_string(version);
+        string replayFrom = "(SELECT MIN(version) - 1 FROM order_changes WHERE changed_at >= "
+                            "(SELECT seen_at FROM change_readers WHERE reader = " + quoteText(conn, readerName(reader)) + ") "
+                            "- INTERVAL " + to_string(FEED_REPLAY_SECONDS) + " SECOND)";
+        q = "SELECT c.version, c.order_id, o.id IS NULL, DATE(o.order_date), o.product_id, o.quantity, o.total_price, IFNULL(o.status, '') "
+            "FROM (SELECT order_id, MAX(version) AS version FROM order_changes WHERE version > LEAST(" + after +
+            ", IFNULL(" + replayFrom + ", " + after + ")) GROUP BY order_id) c "
+            "LEFT JOIN orders o ON o.id = c.order_id ORDER BY c.order_id";
+    }
+
+    // --------------------------------------------------
+    // Stream The Facts
+    // --------------------------------------------------
+    bool ok;
+    {
+        RowStream stream(conn, q, site);
+        ok = stream.ok();
+        for (MYSQL_ROW row : stream)
+        {
+            RowView<long long, long long, int, Date, int, int, Money, string_view> r(row, stream.lengths());
+            head = max(head, r.get<0>());
+            if (r.get<2>() != 0)
+            {
+                visit(OrderFact{r.get<1>(), 0, 0, 0, 0, "", true});
+                continue;
+            }
+            Date d = r.get<3>();
+            visit(OrderFact{r.get<1>(), Format::dayNumber(d.year, d.month, d.day), r.get<4>(), r.get<5>(),
+                            r.get<6>().cents, string(r.get<7>()), false});
+        }
+
+        // #### Mid-Stream Failure Check ####
+        if (ok && stream.failed())
+        {
+            ok = false;
+            *error = mysql_error(conn);
+        }
+        else if (!ok)
+        {
+            *error = QueryExecutor::errorText(conn);
+        }
+    }
+    if (fullLoad)
+    {
+        QueryExecutor::run(conn, ok ? "COMMIT" : "ROLLBACK", site);
+    }
+    if (!ok)
+    {
+        return false;
+    }
+
+    // --------------------------------------------------
+    // Record Progress For Pruning
+    // --------------------------------------------------
+    bool known = false;
+    if (!recordReader(reader, head, readStart, known))
+    {
+        return false;
+    }
+
+    // #### Pruned Reader Check ####
+    // No row on record: this reader was dropped while away, so changes it needed may be gone
+    version = (fullLoad || known) ? head : 0;
+    return true;
+}
+
+bool MySqlOrderRepository::latestChangeVersion(const string& reader, long long& version)
+{
+    chrono::steady_clock::time_point readStart = chrono::steady_clock::now();
+    bool known = false;
+    return readChangeHead(version) && recordReader(reader, version, readStart, known);
+}
+
+bool MySqlOrderRepository::pruneChanges(long long& removed)
+{
+    const char* site = "MySqlOrderRepository::pruneChanges";
+    removed = 0;
+
+    // Readers gone too long stop holding the feed back; they load in full when they return
+    if (QueryExecutor::run(conn, "DELETE FROM change_readers WHERE seen_at < NOW() - INTERVAL " +
+                                 to_string(CHANGE_READER_TTL_HOURS) + " HOUR", site) != 0)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    // --------------------------------------------------
+    // Slowest Reader Left (The Head When There Is None)
+    // --------------------------------------------------
+    QueryExecutor::read(conn, "SELECT IFNULL((SELECT MIN(version) FROM change_readers), (SELECT IFNULL(MAX(version), 0) FROM order_changes))", site);
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+    MYSQL_ROW row = mysql_fetch_row(res);
+    long long horizon = row ? RowView<long long>(row, mysql_fetch_lengths(res)).get<0>() : 0;
+    mysql_free_result(res);
+
+    // Strictly below: the newest row stays, and with it the AUTO_INCREMENT high mark across server restarts
+    if (horizon <= 1)
+    {
+        return true;
+    }
+
+    // --------------------------------------------------
+    // Delete In Chunks, Each Its Own Short Transaction
+    // --------------------------------------------------
+    // Changes inside any reader's replay window stay too (seen_at of the slowest, now without readers)
+    string sql = "DELETE FROM order_changes WHERE version < " + to_string(horizon) +
+                 " AND changed_at < IFNULL((SELECT MIN(seen_at) FROM change_readers), NOW()) - INTERVAL " +
+                 to_string(FEED_REPLAY_SECONDS) + " SECOND ORDER BY version LIMIT " + to_string(MAX_ORDERS_PER_TRANSACTION);
+    my_ulonglong affected = 0;
+    do
+    {
+        if (QueryExecutor::run(conn, sql, site) != 0)
+        {
+            *error = QueryExecutor::errorText(conn);
+            return false;
+        }
+        affected = mysql_affected_rows(conn);
+        removed += (long long)affected;
+    } while (affected == (my_ulonglong)MAX_ORDERS_PER_TRANSACTION);
+    return true;
+}
+
+bool MySqlOrderRepository::forEachOrder(const function<void(const Order&)>& visit)
+{
+    // Rows are streamed straight from the socket (constant memory)
+    RowStream stream(conn, ORDER_SELECT + " ORDER BY o.order_date DESC", "MySqlOrderRepository::forEachOrder");
+    if (!stream.ok())
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    for (MYSQL_ROW row : stream)
+    {
+        visit(orderFromRow(row, stream.lengths()));
+    }
+
+    // #### Mid-Stream Failure Check ####
+    if (stream.failed())
+    {
+        *error = mysql_error(conn);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// 8/9 MySqlIssueRepository
+// ============================================================================
+MySqlIssueRepository::MySqlIssueRepository(MYSQL* c, BatchConnection* b, string* err)
+{
+    conn = c;
+    batchConn = b;
+    error = err;
+}
+
+bool MySqlIssueRepository::listAll(vector<Issue>& out)
+{
+    QueryExecutor::read(conn, "SELECT i.id, i.order_id, o.smart_id, i.issue_type, i.resolution, i.log_date FROM issues i JOIN orders o ON i.order_id = o.id ORDER BY i.id",
+                        "MySqlIssueRepository::listAll");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.clear();
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        out.push_back(issueFromRow(row, mysql_fetch_lengths(res)));
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+bool MySqlIssueRepository::search(const string& keyword, vector<Issue>& out)
+{
+    PreparedQuery q(conn, "SELECT i.id, i.order_id, o.smart_id, i.issue_type, i.resolution, i.log_date FROM issues i JOIN orders o ON i.order_id = o.id "
+                          "WHERE i.issue_type LIKE ? OR i.resolution LIKE ? ORDER BY i.id", "MySqlIssueRepository::search");
+    q.markIdempotent();
+    q.bindString(0, "%" + keyword + "%");
+    q.bindString(1, "%" + keyword + "%");
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+
+    out.clear();
+    while (q.fetch())
+    {
+        out.push_back(Issue{q.getInt(0), q.getInt(1), q.getString(2), q.getString(3), q.getString(4), q.getString(5)});
+    }
+    return true;
+}
+
+Lookup MySqlIssueRepository::find(long long id, Issue& out)
+{
+    PreparedQuery q(conn, "SELECT i.order_id, o.smart_id, i.issue_type, i.resolution, i.log_date FROM issues i JOIN orders o ON i.order_id = o.id WHERE i.id=?",
+                    "MySqlIssueRepository::find");
+    q.markIdempotent();
+    q.bindInt(0, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+
+    out = Issue{id, q.getInt(0), q.getString(1), q.getString(2), q.getString(3), q.getString(4)};
+    return Lookup::Found;
+}
+
+bool MySqlIssueRepository::updateResolution(long long id, const string& resolution)
+{
+    PreparedQuery q(conn, "UPDATE issues SET resolution=? WHERE id=?", "MySqlIssueRepository::updateResolution");
+    q.bindString(0, resolution);
+    q.bindInt(1, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlIssueRepository::remove(long long id)
+{
+    PreparedQuery q(conn, "DELETE FROM issues WHERE id=?", "MySqlIssueRepository::remove");
+    q.bindInt(0, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlIssueRepository::refund(long long orderId, const string& reason)
+{
+    // Update order status -> Log issue (one round trip, one transaction)
+    MYSQL* tx = batchConn->get(error);
+    if (!tx)
+    {
+        return false;
+    }
+    QueryBatch batch(tx, "MySqlIssueRepository::refund");
+    batch.add("START TRANSACTION");
+    batch.add("UPDATE orders SET status='Refunded' WHERE id=" + to_string(orderId));
+    batch.add("INSERT INTO issues (order_id, issue_type, resolution) VALUES (" + to_string(orderId) + ", 'Complaint', " + batch.quote("Refund: " + reason) + ")");
+    batch.add("COMMIT");
+
+    if (!batch.execute())
+    {
+        *error = batch.error();
+        QueryExecutor::run(tx, "ROLLBACK", "MySqlIssueRepository::refund");
+        return false;
+    }
+    return true;
+}
+
+bool MySqlIssueRepository::scheduleRedo(long long orderId, const string& reason, RedoTimeline& out)
+{
+    // Update status & Extend Date -> Log issue -> Calculate Changes (one round trip, one transaction)
+    MYSQL* tx = batchConn->get(error);
+    if (!tx)
+    {
+        return false;
+    }
+    QueryBatch batch(tx, "MySqlIssueRepository::scheduleRedo");
+    batch.add("START TRANSACTION");
+    batch.add("UPDATE orders SET status='Redo In Progress', expected_date = DATE_ADD(NOW(), INTERVAL 7 DAY) WHERE id=" + to_string(orderId));
+    batch.add("INSERT INTO issues (order_id, issue_type, resolution) VALUES (" + to_string(orderId) + ", 'Defect', " + batch.quote("Redo: " + reason) + ")");
+    size_t timeline = batch.add("SELECT DATE(NOW()), DATE(DATE_ADD(NOW(), INTERVAL 3 DAY)), DATE(DATE_ADD(NOW(), INTERVAL 7 DAY))");
+    batch.add("COMMIT");
+
+    if (!batch.execute())
+    {
+        *error = batch.error();
+        QueryExecutor::run(tx, "ROLLBACK", "MySqlIssueRepository::scheduleRedo");
+        return false;
+    }
+
+    MYSQL_RES* res = batch.result(timeline);
+    MYSQL_ROW row = res ? mysql_fetch_row(res) : nullptr;
+    if (row)
+    {
+        RowView<string_view, string_view, string_view> r(row, mysql_fetch_lengths(res));
+        out = RedoTimeline{string(r.get<0>()), string(r.get<1>()), string(r.get<2>())};
+    }
+    return true;
+}
+
+// ============================================================================
+// 9/9 MySqlAdminRepository
+// ============================================================================
+MySqlAdminRepository::MySqlAdminRepository(MYSQL* c, string* err)
+{
+    conn = c;
+    error = err;
+}
+
+Lookup MySqlAdminRepository::authenticate(const string& username, const string& password, string& role)
+{
+    PreparedQuery q(conn, "SELECT role FROM admins WHERE username=? AND password=?", "MySqlAdminRepository::authenticate");
+    q.markIdempotent();
+    q.bindString(0, username);
+    q.bindSecret(1, password);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+    role = q.getString(0);
+    return Lookup::Found;
+}
+
+Lookup MySqlAdminRepository::findByUsername(const string& username, Admin& out)
+{
+    PreparedQuery q(conn, "SELECT id, role FROM admins WHERE username=?", "MySqlAdminRepository::findByUsername");
+    q.markIdempotent();
+    q.bindString(0, username);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+    out = Admin{(int)q.getInt(0), username, "", q.getString(1)};
+    return Lookup::Found;
+}
+
+Lookup MySqlAdminRepository::find(int id, Admin& out)
+{
+    PreparedQuery q(conn, "SELECT username, role FROM admins WHERE id=?", "MySqlAdminRepository::find");
+    q.markIdempotent();
+    q.bindInt(0, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return Lookup::Failed;
+    }
+    if (!q.fetch())
+    {
+        return Lookup::Missing;
+    }
+    out = Admin{id, q.getString(0), "", q.getString(1)};
+    return Lookup::Found;
+}
+
+bool MySqlAdminRepository::listAll(vector<Admin>& out)
+{
+    // Passwords are never read back for listings
+    QueryExecutor::read(conn, "SELECT id, username, role FROM admins", "MySqlAdminRepository::listAll");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+
+    out.clear();
+    MYSQL_ROW row;
+    while ((row = mysql_fetch_row(res)))
+    {
+        RowView<int, string_view, string_view> r(row, mysql_fetch_lengths(res));
+        out.push_back(Admin{r.get<0>(), string(r.get<1>()), "", string(r.get<2>())});
+    }
+    mysql_free_result(res);
+    return true;
+}
+
+bool MySqlAdminRepository::add(Admin& a)
+{
+    PreparedQuery q(conn, "INSERT INTO admins (username, password, role) VALUES (?, ?, ?)", "MySqlAdminRepository::add");
+    q.bindString(0, a.username);
+    q.bindSecret(1, a.password);
+    q.bindString(2, a.role);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    a.id = (int)mysql_insert_id(conn);
+    return true;
+}
+
+bool MySqlAdminRepository::remove(int id)
+{
+    PreparedQuery q(conn, "DELETE FROM admins WHERE id=?", "MySqlAdminRepository::remove");
+    q.bindInt(0, id);
+
+    if (!q.execute())
+    {
+        *error = q.error();
+        return false;
+    }
+    return true;
+}
+
+bool MySqlAdminRepository::count(int& out)
+{
+    QueryExecutor::read(conn, "SELECT COUNT(*) FROM admins", "MySqlAdminRepository::count");
+    MYSQL_RES* res = QueryExecutor::store(conn);
+    if (!res)
+    {
+        *error = QueryExecutor::errorText(conn);
+        return false;
+    }
+    MYSQL_ROW row = mysql_fetch_row(res);
+    out = row ? RowView<int>(row, mysql_fetch_lengths(res)).get<0>() : 0;
+    mysql_free_result(res);
+    return true;
+}
\ No newline at end of file
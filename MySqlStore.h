@@ -0,0 +1,171 @@
+// ============================================================================
+// MYSQL STORE HEADER
+// ============================================================================
+#ifndef MYSQL_STORE_H
+#define MYSQL_STORE_H
+
+// Internal Headers
+#include "Repository.h"  // Repository interfaces
+#include "DatabaseConnection.h" // Batch connection lease
+
+// External Libraries
+#include <mysql.h>      // MySQL C API
+#include <string>       // Error text
+#include <chrono>       // Change feed read start
+
+using namespace std;
+
+// ============================================================================
+// BatchConnection
+// The pool's multi-statement connection for QueryBatch, leased on first use
+// and held until the store is destroyed. Statements that continue a batch's
+// transaction (ROLLBACK, COMMIT) must run on it too.
+// ============================================================================
+class BatchConnection
+{
+public:
+    BatchConnection(DatabaseConnection* p);
+
+    // nullptr when the store has no pool or the lease failed (error says why)
+    MYSQL* get(string* error);
+
+private:
+    DatabaseConnection* pool;           // Pool to lease from (nullptr = no batches)
+    DatabaseConnection::Handle lease;   // Empty until the first batch
+};
+
+// ============================================================================
+// MySQL Repositories
+// Each one works on the connection handed to MySqlStore and writes failures
+// into the store's shared error text. Writes go through prepared statements
+// or quoted batches; reads are marked idempotent so they survive a reconnect.
+// ============================================================================
+class MySqlProductRepository : public ProductRepository
+{
+public:
+    MySqlProductRepository(MYSQL* c, string* err);
+
+    bool listAll(vector<Product>& out) override;
+    Lookup find(int id, Product& out) override;
+    bool searchByName(const string& keyword, vector<Product>& out) override;
+    bool add(Product& p) override;
+    bool update(const Product& p) override;
+    bool remove(int id) override;
+    bool adjustStock(int id, int delta) override;
+
+private:
+    MYSQL* conn;    // Leased connection
+    string* error;  // Store-wide error text
+};
+
+class MySqlOrderRepository : public OrderRepository
+{
+public:
+    MySqlOrderRepository(MYSQL* c, BatchConnection* b, string* err);
+
+    bool listAll(vector<Order>& out) override;
+    Lookup findBySmartId(const string& smartId, Order& out) override;
+    bool reserveDailySequences(int count, int& first, int& day) override;
+    bool countByProduct(int productId, int& out) override;
+    bool listByStatus(const vector<string>& statuses, vector<Order>& out) override;
+    bool listAfterId(long long afterId, vector<Order>& out) override;
+    bool insert(Order& o) override;
+    bool updateStatus(const string& smartId, const string& status) override;
+    bool remove(const string& smartId) override;
+    PlaceResult place(Order& o, bool deductStock) override;
+    PlaceResult placeBulk(const vector<Order>& orders, const map<int, int>& stockTaken) override;
+    bool browse(const OrderFilter& filter, const OrderSeek& seek, int limit, vector<Order>& out) override;
+    bool countByStatus(const OrderSelection& sel, map<string, int>& out) override;
+    bool bulkUpdateStatus(const OrderSelection& sel, const vector<string>& from, const string& to,
+                          int chunkSize, long long& updated) override;
+
+    bool salesByPeriod(const PeriodScope& scope, vector<PeriodSales>& out) override;
+    bool salesTrend(const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall) override;
+    bool extremeOrders(bool highest, int limit, vector<Order>& out) override;
+    bool rebuildSalesRollup(long long& rows) override;
+    bool verifySalesRollup(long long& mismatches) override;
+    bool forEachChange(const string& reader, long long& version, const function<void(const OrderFact&)>& visit) override;
+    bool latestChangeVersion(const string& reader, long long& version) override;
+    bool pruneChanges(long long& removed) override;
+    bool forEachOrder(const function<void(const Order&)>& visit) override;
+
+private:
+    MYSQL* conn;                // Leased connection
+    BatchConnection* batchConn; // Multi-statement connection for QueryBatch
+    string* error;              // Store-wide error text
+
+    bool insertRow(Order& o, bool& transient);
+    PlaceResult placeOnce(Order& o, bool deductStock, bool& transient);
+    PlaceResult placeBulkOnce(const vector<Order>& orders, const map<int, int>& stockTaken, bool& transient);
+    PlaceResult commitOrders(MYSQL* tx, const string& probeSmartId, bool& transient);
+    bool readChangeHead(long long& head);
+    bool recordReader(const string& reader, long long version, chrono::steady_clock::time_point readStart, bool& known);
+};
+
+class MySqlIssueRepository : public IssueRepository
+{
+public:
+    MySqlIssueRepository(MYSQL* c, BatchConnection* b, string* err);
+
+    bool listAll(vector<Issue>& out) override;
+    bool search(const string& keyword, vector<Issue>& out) override;
+    Lookup find(long long id, Issue& out) override;
+    bool updateResolution(long long id, const string& resolution) override;
+    bool remove(long long id) override;
+    bool refund(long long orderId, const string& reason) override;
+    bool scheduleRedo(long long orderId, const string& reason, RedoTimeline& out) override;
+
+private:
+    MYSQL* conn;                // Leased connection
+    BatchConnection* batchConn; // Multi-statement connection for QueryBatch
+    string* error;              // Store-wide error text
+};
+
+class MySqlAdminRepository : public AdminRepository
+{
+public:
+    MySqlAdminRepository(MYSQL* c, string* err);
+
+    Lookup authenticate(const string& username, const string& password, string& role) override;
+    Lookup findByUsername(const string& username, Admin& out) override;
+    Lookup find(int id, Admin& out) override;
+    bool listAll(vector<Admin>& out) override;
+    bool add(Admin& a) override;
+    bool remove(int id) override;
+    bool count(int& out) override;
+
+private:
+    MYSQL* conn;    // Leased connection
+    string* error;  // Store-wide error text
+};
+
+// ============================================================================
+// MySqlStore
+// DataStore over one leased connection. Cheap to build: main creates one per
+// screen around the handle it leased from DatabaseConnection. Period reports
+// are one grouped (period, item) query over the daily_product_sales rollup,
+// reduced client-side. Orders are placed
+// in a transaction that is re-run on deadlock or a lost session.
+// ============================================================================
+class MySqlStore : public DataStore
+{
+public:
+    // pool supplies the batch connection; without one, batched writes fail
+    MySqlStore(MYSQL* c, DatabaseConnection* pool = nullptr);
+
+    ProductRepository& products() override;
+    OrderRepository& orders() override;
+    IssueRepository& issues() override;
+    AdminRepository& admins() override;
+    string lastError() override;
+
+private:
+    string error;                   // Shared by the repositories below
+    BatchConnection batchConn;      // Declared before the repositories that use it
+    MySqlProductRepository productRepo;
+    MySqlOrderRepository orderRepo;
+    MySqlIssueRepository issueRepo;
+    MySqlAdminRepository adminRepo;
+};
+
+#endif
\ No newline at end of file
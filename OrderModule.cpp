@@ -9,15 +9,29 @@
 #include <ctime>       // Time functions for dates
 #include <iomanip>     // Formatting (setw, setfill)
 #include <string>      // String manipulation
-#include <sstream>     // String streams for date construction
+#include <sstream>     // Order ID list parsing
 #include <cstdlib>     // Standard lib (system, atoi)
 #include <limits>      // Numeric limits
+#include <cctype>      // Date format check, case folding
+#include <chrono>      // Import timing
+#include <fstream>     // Import error report
+#include <map>         // Per-product stock
+#include <algorithm>   // sort, equal
+#include <vector>      // Import rows
 #include "Utils.h"     // Shared Utility Functions
+#include "SelectableListing.h" // Row number -> order ID for the page on screen
+#include "ImportReader.h"      // CSV / JSONL records for bulk import
+#include "ResultStream.h"      // Import progress line
+#include "OrderStatus.h"       // Status transition rules
+#include "ProductCatalog.h"    // Cached product catalog
+#include "ProductionScheduler.h" // Workshop backlog and capacity
+#include "OrderSearchIndex.h"   // Front-desk order search
+#include "Format.h"             // Date, timestamp and smart_id text
 
 using namespace std;
 
 // ============================================================================
-// 2/11 printSuccess
+// 2/15 printSuccess
 // ============================================================================
 static void printSuccess(string msg)
 {
@@ -27,7 +41,7 @@ static void printSuccess(string msg)
 }
 
 // ============================================================================
-// 3/11 printError
+// 3/15 printError
 // ============================================================================
 static void printError(string msg)
 {
@@ -35,24 +49,29 @@ static void printError(string msg)
 }
 
 // ============================================================================
-// 4/11 OrderModule (Constructor)
+// 4/15 OrderModule (Constructor)
 // ============================================================================
-OrderModule::OrderModule(MYSQL* c)
+OrderModule::OrderModule(DataStore* s)
 {
-    conn = c;
+    store = s;
 }
 
 // ============================================================================
-// 5/11 showTable
+// 5/15 showTable
 // ============================================================================
 void OrderModule::showTable()
 {
     // --------------------------------------------------
-    // Fetch Product Inventory
+    // Fetch Product Inventory (Cached Catalog)
     // --------------------------------------------------
-    mysql_query(conn, "SELECT id, name, type, price, stock_quantity, production_hours FROM products");
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+
+    // #### Query Failure Check ####
+    if (!catalog)
+    {
+        printError(store->lastError());
+        return;
+    }
 
     cout << "\n   AVAILABLE PRODUCTS\n";
     cout << "  ┌─────┬────────────────────┬──────────────┬────────────┬──────────┬────────┐\n";
@@ -62,104 +81,123 @@ void OrderModule::showTable()
     // --------------------------------------------------
     // Populate List
     // --------------------------------------------------
-    while ((row = mysql_fetch_row(res)))
+    for (const Product& p : catalog->products)
     {
-        string stock = row[4] ? row[4] : "0";
-        string hours = row[5] ? row[5] : "0";
-        int idNum = atoi(row[0]);
-
         cout << "  │ " 
-             << right << setfill('0') << setw(3) << idNum << setfill(' ') << " │ " 
-             << left  << setw(18) << row[1] << " │ " 
-             << left  << setw(12) << row[2] << " │ RM " 
-             << left  << setw(7) << row[3] << " │ " 
-             << left  << setw(8) << stock << " │ " 
-             << left  << setw(6) << hours << " │\n";
+             << right << setfill('0') << setw(3) << p.id << setfill(' ') << " │ " 
+             << left  << setw(18) << p.name << " │ " 
+             << left  << setw(12) << p.type << " │ RM " 
+             << left  << setw(7) << Utils::formatMoney(p.price) << " │ " 
+             << left  << setw(8) << p.stock << " │ " 
+             << left  << setw(6) << p.productionHours << " │\n";
     }
     cout << "  └─────┴────────────────────┴──────────────┴────────────┴──────────┴────────┘\n";
-    mysql_free_result(res);
 }
 
 // ============================================================================
-// 6/11 getTodayDate
+// 6/15 getTodayDate
 // ============================================================================
 string OrderModule::getTodayDate()
 {
-    time_t now = time(0);
-    tm* ltm = localtime(&now);
-    stringstream ss;
     // Format: YYYY-MM-DD
-    ss << (1900 + ltm->tm_year) << "-" << setfill('0') << setw(2) << (1 + ltm->tm_mon) << "-" << setfill('0') << setw(2) << ltm->tm_mday;
-    return ss.str();
+    return Format::date(time(0));
 }
 
 // ============================================================================
-// 7/11 calculateDate
+// 7/15 calculateDate
 // ============================================================================
-string OrderModule::calculateDate(int hoursPerUnit, int qty)
+string OrderModule::calculateDate(int hoursPerUnit, int qty, double hoursAhead)
 {
     // --------------------------------------------------
     // Calculate Production Time
     // --------------------------------------------------
-    time_t now = time(0); 
-    long prodSeconds = (long)qty * hoursPerUnit * 3600; 
-    
-    // Default 1 day minimum if ready stock
-    if (prodSeconds == 0)
+    // Custom work starts once the queued backlog is done, at the workshop's daily hours
+    double work = (double)qty * hoursPerUnit;
+    if (work > 0)
     {
-        prodSeconds = 24 * 3600;
+        work += hoursAhead;
     }
+    time_t prodEnd = ProductionScheduler::finishTime(work);
     
     // --------------------------------------------------
     // Add Shipping Time (3 Days)
     // --------------------------------------------------
     long shippingSeconds = 3 * 24 * 3600; 
-    time_t future = now + prodSeconds + shippingSeconds; 
-    tm* f = localtime(&future);
-    
-    stringstream ss;
-    ss << (1900 + f->tm_year) << "-" << setfill('0') << setw(2) << (1 + f->tm_mon) << "-" << setfill('0') << setw(2) << f->tm_mday << " " 
-       << setfill('0') << setw(2) << f->tm_hour << ":" << setfill('0') << setw(2) << f->tm_min << ":" << setfill('0') << setw(2) << f->tm_sec;
-    return ss.str();
+    time_t future = prodEnd + shippingSeconds; 
+    return Format::stamp(future);
 }
 
 // ============================================================================
-// 8/11 getShippingDateDisplay (Local Helper)
+// 8/15 getShippingDateDisplay / shiftDays (Local Helpers)
 // ============================================================================
-string getShippingDateDisplay(int hoursPerUnit, int qty)
+string getShippingDateDisplay(int hoursPerUnit, int qty, double hoursAhead)
 {
-    time_t now = time(0);
-    long prodSeconds = (long)qty * hoursPerUnit * 3600;
-    
-    if (prodSeconds == 0)
+    double work = (double)qty * hoursPerUnit;
+    if (work > 0)
     {
-        prodSeconds = 24 * 3600;
+        work += hoursAhead;
     }
     
     // Shipping starts after production ends
-    time_t shipTime = now + prodSeconds;
-    tm* f = localtime(&shipTime);
-    stringstream ss;
-    ss << (1900 + f->tm_year) << "-" << setfill('0') << setw(2) << (1 + f->tm_mon) << "-" << setfill('0') << setw(2) << f->tm_mday;
-    return ss.str();
+    time_t shipTime = ProductionScheduler::finishTime(work);
+    return Format::date(shipTime);
+}
+
+// YYYY-MM-DD of a DATETIME text moved by whole days
+static string shiftDays(const string& datetime, int days)
+{
+    if (datetime.length() < 10)
+    {
+        return datetime;
+    }
+
+    tm t = {};
+    t.tm_year = atoi(datetime.substr(0, 4).c_str()) - 1900;
+    t.tm_mon = atoi(datetime.substr(5, 2).c_str()) - 1;
+    t.tm_mday = atoi(datetime.substr(8, 2).c_str()) + days;
+    t.tm_hour = 12;
+    mktime(&t);
+
+    char buf[11];
+    strftime(buf, sizeof(buf), "%Y-%m-%d", &t);
+    return buf;
 }
 
 // ============================================================================
-// 9/11 generateID
+// 9/15 generateID / idPrefix / bulkDiscount (Order Rules)
+// Shared by placeOrder and importOrders so both price and label alike.
 // ============================================================================
-string OrderModule::generateID(string type, int seq)
+string OrderModule::generateID(string type, int day, int seq)
+{
+    // Format Example: FAIX-15022025-001 (day is the sequence counter's, not this PC's clock)
+    return Format::smartId(type, day, seq);
+}
+
+string OrderModule::idPrefix(const string& productName)
+{
+    if (productName == "Phone Case") 
+    { 
+        return "CAS"; 
+    }
+    else if (productName.find("T-Shirt") != string::npos) 
+    { 
+        return "TSH"; 
+    }
+    else if (productName.find("Cap") != string::npos) 
+    { 
+        return "CAP"; 
+    }
+    return "FAI";
+}
+
+double OrderModule::bulkDiscount(double subtotal, int qty)
 {
-    time_t now = time(0);
-    tm* ltm = localtime(&now);
-    stringstream ss;
-    // Format Example: FAIX-15022025-001
-    ss << type << "-" << setfill('0') << setw(2) << ltm->tm_mday << setfill('0') << setw(2) << 1 + ltm->tm_mon 
-       << (1900 + ltm->tm_year) << "-" << setfill('0') << setw(3) << seq;
-    return ss.str();
+    // 10% off orders of 10 units or more
+    return (qty >= 10) ? subtotal * 0.10 : 0.0;
 }
 
 // ============================================================================
-// 10/11 placeOrder
+// 10/15 placeOrder
 // ============================================================================
 void OrderModule::placeOrder()
 {
@@ -190,26 +228,23 @@ void OrderModule::placeOrder()
     // --------------------------------------------------
     // Retrieve Product Details
     // --------------------------------------------------
-    string sql = "SELECT name, type, price, production_hours, stock_quantity FROM products WHERE id=" + to_string(id);
-    mysql_query(conn, sql.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row = mysql_fetch_row(res);
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+    const Product* found = catalog ? catalog->find(id) : nullptr;
 
     // #### Invalid ID Check ####
-    if (!row)
+    if (!found)
     {
         printError("Invalid ID.");
-        mysql_free_result(res);
         system("pause");
         return;
     }
+    Product product = *found;
     
-    string pName = row[0];
-    string pType = row[1];
-    double price = stod(row[2]);
-    int prodHours = stoi(row[3]);
-    int currentStock = stoi(row[4]); 
-    mysql_free_result(res);
+    string pName = product.name;
+    string pType = product.type;
+    double price = product.price;
+    int prodHours = product.productionHours;
+    int currentStock = product.stock; 
 
     cout << "\n   \033[1;33m✔ Selected Item : " << pName << "\033[0m\n";
     cout << "   \033[1;33m✔ Category      : " << pType << "\033[0m\n";
@@ -391,46 +426,39 @@ void OrderModule::placeOrder()
     // Calculate Totals
     // --------------------------------------------------
     double subtotal = price * qty;
-    double discount = 0.0;
-    string discountMsg = "No Discount";
+    double discount = bulkDiscount(subtotal, qty);
+    string discountMsg = (discount > 0.0) ? "10% Bulk Discount" : "No Discount";
 
-    if (qty >= 10)
+    double finalTotal = subtotal - discount;
+
+    // #### Workshop Backlog Check ####
+    // Custom orders queue behind every order already waiting for the workshop
+    if (prodHours > 0 && !ProductionScheduler::refresh(*store))
     {
-        discount = subtotal * 0.10; 
-        discountMsg = "10% Bulk Discount";
+        printError(store->lastError());
+        system("pause");
+        return;
     }
+    double hoursAhead = (prodHours > 0) ? ProductionScheduler::hoursAhead() : 0.0;
 
-    double finalTotal = subtotal - discount;
-
-    string sqlArrivalDate = calculateDate(prodHours, qty); 
-    string displayShipDate = getShippingDateDisplay(prodHours, qty); 
+    string sqlArrivalDate = calculateDate(prodHours, qty, hoursAhead); 
+    string displayShipDate = getShippingDateDisplay(prodHours, qty, hoursAhead); 
     string displayToday = getTodayDate(); 
 
     // --------------------------------------------------
     // Generate Order ID
     // --------------------------------------------------
-    mysql_query(conn, "SELECT COUNT(*) FROM orders WHERE DATE(order_date) = CURDATE()");
-    MYSQL_RES* rS = mysql_store_result(conn); 
-    MYSQL_ROW rR = mysql_fetch_row(rS);
-    int seq = stoi(rR[0]) + 1; 
-    mysql_free_result(rS);
-
-    string code = "FAI"; 
-    
-    if (pName == "Phone Case") 
-    { 
-        code = "CAS"; 
-    }
-    else if (pName.find("T-Shirt") != string::npos) 
-    { 
-        code = "TSH"; 
-    }
-    else if (pName.find("Cap") != string::npos) 
-    { 
-        code = "CAP"; 
+    // Taken from today's counter, so parallel clerks never share a number
+    int seq = 0;
+    int seqDay = 0;
+    if (!store->orders().reserveDailySequences(1, seq, seqDay))
+    {
+        printError(store->lastError());
+        system("pause");
+        return;
     }
-    
-    string finalID = generateID(code, seq);
+
+    string finalID = generateID(idPrefix(pName), seqDay, seq);
 
     // --------------------------------------------------
     // Show Receipt
@@ -455,6 +483,11 @@ void OrderModule::placeOrder()
     cout << "\n   TIMELINE\n";
     cout << "   ──────────────────────────────────────────────────────\n";
     cout << "   Order Date   : " << displayToday << "\n";
+    if (prodHours > 0)
+    {
+        cout << "   Workshop     : " << (long long)hoursAhead << " h queued ahead, "
+             << ProductionScheduler::dailyHours() << " h/day\n";
+    }
     cout << "   Shipping Est : " << displayShipDate << "\n"; 
     cout << "   Arrival Est  : " << sqlArrivalDate.substr(0,10) << "\n";
     cout << "\n";
@@ -469,12 +502,20 @@ void OrderModule::placeOrder()
     // --------------------------------------------------
     if (confirm == 1)
     {
-        stringstream ss;
-        ss << "INSERT INTO orders (smart_id, product_id, customer_name, address, quantity, total_price, expected_date, cust_size, cust_color, cust_text) VALUES ('"
-           << finalID << "', " << id << ", '" << custName << "', '" << addr << "', " << qty << ", " << finalTotal << ", '" << sqlArrivalDate << "', '" << size << "', '" << color << "', '" << text << "')";
+        Order order{0, finalID, id, pName, custName, addr, qty, finalTotal, "", sqlArrivalDate, "Pending", size, color, text};
         
-        if (!mysql_query(conn, ss.str().c_str()))
+        // Order row and Ready Stock deduction commit together, or not at all
+        PlaceResult placed = store->orders().place(order, pType == "Ready Stock");
+
+        if (placed == PlaceResult::Placed)
         {
+            if (pType == "Ready Stock")
+            {
+                ProductCatalog::adjustStock(id, -qty);
+            }
+            ProductionScheduler::add(order, prodHours);
+            OrderSearchIndex::add(order);
+
             cout << "\n   ────────────────────────────────────────────────────────\n";
             cout << "\n";
             cout << "    \033[1;32m✔ Order confirmed\033[0m\n";
@@ -486,26 +527,77 @@ void OrderModule::placeOrder()
             }
             cout << "    \033[1;32m✔ Processing will begin shortly\033[0m\n";
             cout << "\n   ────────────────────────────────────────────────────────\n";
-            
-            // --------------------------------------------------
-            // Deduct Stock (If Applicable)
-            // --------------------------------------------------
-            if (pType == "Ready Stock")
-            {
-                mysql_query(conn, ("UPDATE products SET stock_quantity = stock_quantity - " + to_string(qty) + " WHERE id=" + to_string(id)).c_str());
-            }
+        }
+        // #### Sold Out Meanwhile Check ####
+        else if (placed == PlaceResult::OutOfStock)
+        {
+            // Another terminal sold it; the cached stock level is stale
+            ProductCatalog::bump();
+            Product latest;
+            int left = (store->products().find(id, latest) == Lookup::Found) ? latest.stock : 0;
+            printError("Order not placed: only " + to_string(left) + " left in stock now.");
+        }
+        else
+        {
+            printError(store->lastError());
         }
     }
     system("pause"); 
 }
 
 // ============================================================================
-// 11/11 trackOrder
+// 11/15 readDate / promptFilter
+// ============================================================================
+// #### Date Format Check ####
+// Anything but YYYY-MM-DD leaves that end of the range open
+static string readDate(const string& prompt)
+{
+    cout << prompt;
+    string d = Utils::getValidString(10);
+    bool ok = (d.length() == 10 && d[4] == '-' && d[7] == '-');
+    for (int i = 0; ok && i < 10; i++)
+    {
+        if (i != 4 && i != 7 && !isdigit((unsigned char)d[i])) ok = false;
+    }
+    if (!ok && d != "0")
+    {
+        printError("Date ignored (use YYYY-MM-DD).");
+    }
+    return ok ? d : string();
+}
+
+OrderFilter OrderModule::promptFilter()
+{
+    static const char* statuses[] = {"", "Pending", "Processing", "In Production", "Shipped", "Completed", "Cancelled", "Refunded", "Redo In Progress"};
+    OrderFilter filter;
+
+    cout << "\n   FILTER BY STATUS\n   ──────────────────\n";
+    for (int i = 1; i <= 8; i++)
+    {
+        cout << "    " << i << ") " << statuses[i] << "\n";
+    }
+    cout << "    0) Any Status\n   Select ➜ ";
+    filter.status = statuses[Utils::getValidRange(0, 8)];
+    filter.fromDate = readDate("   From Date (YYYY-MM-DD, 0 = Any) ➜ ");
+    filter.toDate = readDate("   To Date   (YYYY-MM-DD, 0 = Any) ➜ ");
+    return filter;
+}
+
+// ============================================================================
+// 12/15 trackOrder
 // ============================================================================
 void OrderModule::trackOrder()
 {
+    const int PAGE_SIZE = 10;
+    const OrderSeek newestPage{"", 0, true};
+
     int choice;
     string targetID = "";
+
+    // The seek that produced the page on screen, so a refresh stays on that page
+    OrderFilter filter;
+    OrderSeek current = newestPage;
+    int pageNo = 1;
     do
     {
         system("cls");
@@ -515,38 +607,64 @@ void OrderModule::trackOrder()
         cout << "  ╚══════════════════════════════════════════════════════╝\n";
 
         // --------------------------------------------------
-        // Retrieve Active Orders
+        // Retrieve One Page of Orders
         // --------------------------------------------------
-        mysql_query(conn, "SELECT o.smart_id, o.customer_name, o.status, o.total_price, p.name FROM orders o JOIN products p ON o.product_id = p.id");
-        MYSQL_RES* res = mysql_store_result(conn);
-        MYSQL_ROW row;
-        int totalRows = mysql_num_rows(res);
+        // Pages read downwards ask for one extra row to learn whether an older page exists
+        bool upwards = !current.orderDate.empty() && !current.older;
+        vector<Order> orders;
+        if (!store->orders().browse(filter, current, upwards ? PAGE_SIZE : PAGE_SIZE + 1, orders))
+        {
+            printError(store->lastError());
+        }
+
+        // #### Short Previous Page Check ####
+        // Rows above the key were deleted or filtered out: fall back to the newest page
+        if (upwards && (int)orders.size() < PAGE_SIZE)
+        {
+            current = newestPage;
+            pageNo = 1;
+            upwards = false;
+            if (!store->orders().browse(filter, current, PAGE_SIZE + 1, orders))
+            {
+                printError(store->lastError());
+            }
+        }
 
-        cout << "\n   [ ACTIVE ORDERS ]\n";
+        bool hasOlder = upwards || (int)orders.size() > PAGE_SIZE;
+        if ((int)orders.size() > PAGE_SIZE)
+        {
+            orders.pop_back();
+        }
+        int totalRows = (int)orders.size();
+        SelectableListing listing;
+
+        cout << "\n   [ ORDERS - PAGE " << pageNo << " ]";
+        if (!filter.status.empty()) cout << "  Status: " << filter.status;
+        if (!filter.fromDate.empty()) cout << "  From: " << filter.fromDate;
+        if (!filter.toDate.empty()) cout << "  To: " << filter.toDate;
+        cout << "\n";
         cout << "  ┌─────┬──────────────────────┬──────────────────────┬──────────────────────┬──────────────────────┬────────────┐\n";
         cout << "  │  No │ ORDER ID             │ ITEM NAME            │ CUSTOMER             │ STATUS               │ TOTAL (RM) │\n";
         cout << "  ├─────┼──────────────────────┼──────────────────────┼──────────────────────┼──────────────────────┼────────────┤\n";
         
         if (totalRows > 0)
         {
-            int i = 1;
-            while ((row = mysql_fetch_row(res))) 
+            for (const Order& o : orders) 
             {
                 cout << "  │ " 
-                     << left << setw(3) << i++ << " │ " 
-                     << left << setw(20) << row[0] << " │ " 
-                     << left << setw(20) << row[4] << " │ " 
-                     << left << setw(20) << row[1] << " │ " 
-                     << left << setw(20) << row[2] << " │ " 
-                     << left << setw(10) << row[3] << " │\n"; 
+                     << left << setw(3) << listing.add(o.smartId) << " │ " 
+                     << left << setw(20) << o.smartId << " │ " 
+                     << left << setw(20) << o.productName << " │ " 
+                     << left << setw(20) << o.customerName << " │ " 
+                     << left << setw(20) << o.status << " │ " 
+                     << left << setw(10) << Utils::formatMoney(o.totalPrice) << " │\n"; 
             }
         }
         else
         {
-             cout << "  │ " << setw(108) << "No active orders found." << " │\n";
+             cout << "  │ " << setw(108) << "No orders found." << " │\n";
         }
         cout << "  └─────┴──────────────────────┴──────────────────────┴──────────────────────┴──────────────────────┴────────────┘\n";
-        mysql_free_result(res);
 
         // --------------------------------------------------
         // Selection Menu
@@ -554,19 +672,63 @@ void OrderModule::trackOrder()
         cout << "\n   [ ACTIONS ]\n";
         cout << "   ──────────────────────────────────────────────────────\n";
         cout << "    1) View Detail (Select Row #)\n";
-        cout << "    2) Search by ID (e.g. FAIX-...)\n";
+        cout << "    2) Search (ID Prefix / Customer / Date)\n";
+        cout << "    3) Next Page (Older)\n";
+        cout << "    4) Previous Page (Newer)\n";
+        cout << "    5) Filter by Status / Date\n";
+        cout << "    6) Bulk Status Update\n";
         cout << "\n";
         cout << "    0) Back\n";
         cout << "  ────────────────────────────────────────────────────────\n";
         cout << "   Choice ➜ "; 
         
-        choice = Utils::getValidRange(0, 2);
+        choice = Utils::getValidRange(0, 6);
         
         if (choice == 0)
         {
             break;
         }
 
+        // --------------------------------------------------
+        // Page Navigation
+        // --------------------------------------------------
+        if (choice == 3)
+        {
+            if (!hasOlder || totalRows == 0)
+            {
+                printError("This is the last page.");
+                system("pause");
+                continue;
+            }
+            current = OrderSeek{orders.back().orderDate, orders.back().id, true};
+            pageNo++;
+            continue;
+        }
+        if (choice == 4)
+        {
+            if (pageNo == 1)
+            {
+                printError("This is the first page.");
+                system("pause");
+                continue;
+            }
+            current = (totalRows == 0) ? newestPage : OrderSeek{orders.front().orderDate, orders.front().id, false};
+            pageNo = (totalRows == 0) ? 1 : pageNo - 1;
+            continue;
+        }
+        if (choice == 5)
+        {
+            filter = promptFilter();
+            current = newestPage;
+            pageNo = 1;
+            continue;
+        }
+        if (choice == 6)
+        {
+            bulkStatusUpdate(filter);
+            continue;
+        }
+
         targetID = "";
 
         // --------------------------------------------------
@@ -574,37 +736,17 @@ void OrderModule::trackOrder()
         // --------------------------------------------------
         if (choice == 1)
         {
-             if (totalRows == 0)
+             if (listing.empty())
              {
                  printError("No orders to select.");
                  system("pause");
                  continue;
              }
-             cout << "\n   Enter Row # ➜ ";
-             int sel = Utils::getValidRange(1, totalRows);
-             if (sel < 1 || sel > totalRows)
-             {
-                 printError("Invalid Row.");
-                 system("pause");
-                 continue;
-             }
-             
-             // Retrieve actual ID using LIMIT offset
-             int offset = sel - 1;
-             string getIDQ = "SELECT smart_id FROM orders LIMIT " + to_string(offset) + ", 1";
-             mysql_query(conn, getIDQ.c_str());
-             MYSQL_RES* resID = mysql_store_result(conn);
-             MYSQL_ROW rowID = mysql_fetch_row(resID);
-             if (rowID)
-             {
-                 targetID = rowID[0];
-             }
-             mysql_free_result(resID);
+             targetID = listing.select("\n   Enter Row # (0 to Cancel) ➜ ");
         }
         else if (choice == 2)
         {
-             cout << "   Enter Order ID ➜ ";
-             targetID = Utils::getValidString();
+             targetID = searchOrders();
         }
         else
         {
@@ -621,38 +763,35 @@ void OrderModule::trackOrder()
         // --------------------------------------------------
         // Fetch Details
         // --------------------------------------------------
-        string sql = "SELECT o.smart_id, o.status, o.customer_name, p.name, o.quantity, p.price, o.total_price, o.cust_size, o.cust_color, o.cust_text, o.order_date, o.expected_date, DATE_SUB(o.expected_date, INTERVAL 3 DAY) FROM orders o JOIN products p ON o.product_id = p.id WHERE o.smart_id='" + targetID + "'";
-        mysql_query(conn, sql.c_str()); 
-        res = mysql_store_result(conn); 
-        row = mysql_fetch_row(res);
+        Order detail;
 
         // #### Found Check ####
-        if (row)
+        if (store->orders().findBySmartId(targetID, detail) == Lookup::Found)
         {
             cout << "\n";
             cout << "  ╔══════════════════════════════════════════════════════╗\n";
             cout << "  ║                    ORDER DETAILS                     ║\n";
             cout << "  ╚══════════════════════════════════════════════════════╝\n";
-            cout << "   Order ID    : \033[1;33m" << row[0] << "\033[0m\n"; 
-            cout << "   Status      : " << row[1] << "\n";
-            cout << "   Customer    : " << row[2] << "\n";
+            cout << "   Order ID    : \033[1;33m" << detail.smartId << "\033[0m\n"; 
+            cout << "   Status      : " << detail.status << "\n";
+            cout << "   Customer    : " << detail.customerName << "\n";
             cout << "   ──────────────────────────────────────────────────────\n";
-            cout << "   Item        : " << row[3] << "\n";
-            cout << "   Quantity    : " << row[4] << "\n";
-            cout << "   Specs       : " << row[7] << " | " << row[8] << " | " << row[9] << "\n";
-            cout << "   Total       : RM " << row[6] << "\n";
+            cout << "   Item        : " << detail.productName << "\n";
+            cout << "   Quantity    : " << detail.quantity << "\n";
+            cout << "   Specs       : " << detail.custSize << " | " << detail.custColor << " | " << detail.custText << "\n";
+            cout << "   Total       : RM " << Utils::formatMoney(detail.totalPrice) << "\n";
             cout << "   ──────────────────────────────────────────────────────\n";
-            string dOrder = row[10]; 
-            string dArriv = row[11];
+            string dOrder = detail.orderDate; 
+            string dArriv = detail.expectedDate;
             if (dOrder.length() >= 10) 
             {
                 cout << "   Ordered On  : " << dOrder.substr(0,10) << "\n";
             }
             
-            string dShip = row[12];
+            // Shipping leaves 3 days before the expected arrival
             if (dArriv.length() >= 10) 
             {
-                 cout << "   Shipping Est: " << (dShip.length() >= 10 ? dShip.substr(0,10) : dShip) << "\n"; 
+                 cout << "   Shipping Est: " << shiftDays(dArriv, -3) << "\n"; 
                  cout << "   Arrival Est : " << dArriv.substr(0,10) << "\n";
             }
             cout << "  ========================================================\n";
@@ -682,9 +821,26 @@ void OrderModule::trackOrder()
                  else if (s == 4) newS = "Completed"; 
                  else if (s == 5) newS = "Cancelled"; 
                  
-                 if (newS != "") 
+                 // #### Transition Check ####
+                 // The update is conditional on the status shown, so a concurrent change is not overwritten
+                 long long changed = 0;
+                 OrderSelection one{OrderFilter(), 0, {targetID}};
+                 if (!OrderStatus::canMove(detail.status, newS))
+                 {
+                     printError("Cannot change status from " + detail.status + " to " + newS + ".");
+                 }
+                 else if (!store->orders().bulkUpdateStatus(one, {detail.status}, newS, 1, changed))
+                 {
+                     printError(store->lastError());
+                 }
+                 else if (changed == 0)
                  {
-                     mysql_query(conn, ("UPDATE orders SET status='" + newS + "' WHERE smart_id='" + targetID + "'").c_str());
+                     printError("Order was changed meanwhile. Reopen it and try again.");
+                 }
+                 else
+                 {
+                     ProductionScheduler::statusChanged(targetID, newS);
+                     OrderSearchIndex::statusChanged(targetID, newS);
                      printSuccess("Status Updated");
                  }
             } 
@@ -694,8 +850,13 @@ void OrderModule::trackOrder()
                 int confirm = Utils::getValidRange(0, 1);
                 if (confirm == 1) 
                 {
-                    mysql_query(conn, ("DELETE FROM orders WHERE smart_id='" + targetID + "'").c_str());
-                    printSuccess("Order Deleted");
+                    if (store->orders().remove(targetID))
+                    {
+                        ProductionScheduler::statusChanged(targetID, "");
+                        OrderSearchIndex::remove(targetID);
+                        printSuccess("Order Deleted");
+                    }
+                    else printError(store->lastError());
                 }
             }
         }
@@ -703,7 +864,520 @@ void OrderModule::trackOrder()
         { 
             printError("Order Not Found."); 
         }
-        mysql_free_result(res); 
         system("pause"); 
     } while(choice != 0);
+}
+// ============================================================================
+// 13/15 importOrders
+// ============================================================================
+// Case-insensitive match against allowed values; on success value takes the canonical spelling
+static bool pickOption(string& value, const vector<string>& allowed)
+{
+    for (const string& a : allowed)
+    {
+        if (a.length() == value.length() &&
+            equal(a.begin(), a.end(), value.begin(), [](char x, char y) { return tolower((unsigned char)x) == tolower((unsigned char)y); }))
+        {
+            value = a;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The customization rules placeOrder's menus enforce; returns why a row breaks them, or ""
+static string checkOptions(const Product& p, string& size, string& color, string& text)
+{
+    if (p.name == "Phone Case")
+    {
+        if (!pickOption(size, {"iPhone 17", "Samsung S25", "Redmi Note 12"})) return "Unknown phone model '" + size + "'";
+        if (!pickOption(color, {"Black", "White", "Transparent"})) return "Unknown colour '" + color + "'";
+        if (text.empty() || text.length() > 10) return "Custom text must be 1-10 characters";
+        return "";
+    }
+    if (p.name.find("T-Shirt") != string::npos)
+    {
+        if (!pickOption(size, {"XS", "S", "M", "L", "XL"})) return "Unknown size '" + size + "'";
+        if (p.type != "Custom")
+        {
+            color = "Official Black";
+            text = "N/A";
+            return "";
+        }
+        if (!pickOption(color, {"Black", "White", "Navy Blue"})) return "Unknown colour '" + color + "'";
+        if (text.empty() || text.length() > 15) return "Custom text must be 1-15 characters";
+        return "";
+    }
+    size = color = text = "N/A";
+    return "";
+}
+
+void OrderModule::importOrders()
+{
+    // Orders per transaction; each is sent as multi-row INSERTs in one round trip
+    const size_t CHUNK_ROWS = MAX_ORDERS_PER_TRANSACTION;
+
+    system("cls");
+    cout << "\n";
+    cout << "  ╔══════════════════════════════════════════════════════╗\n";
+    cout << "  ║                  BULK ORDER IMPORT                   ║\n";
+    cout << "  ╚══════════════════════════════════════════════════════╝\n";
+    cout << "   CSV header / JSONL keys:\n";
+    cout << "     product_id (or product), customer_name, address,\n";
+    cout << "     quantity, size, color, text\n";
+    cout << "   [ INFO: Enter 0 to Cancel ]\n\n";
+    cout << "   File Path (.csv / .jsonl) ➜ ";
+    string path = Utils::getValidString();
+
+    // #### Cancel Check ####
+    if (path == "0")
+    {
+        return;
+    }
+
+    ImportReader reader(path);
+    if (!reader.open())
+    {
+        printError("Cannot open " + path);
+        system("pause");
+        return;
+    }
+    chrono::steady_clock::time_point started = chrono::steady_clock::now();
+
+    // --------------------------------------------------
+    // Product Catalog (Shared Cache)
+    // --------------------------------------------------
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+    if (!catalog)
+    {
+        printError(store->lastError());
+        system("pause");
+        return;
+    }
+    map<int, int> stockLeft;
+    for (const Product& p : catalog->products)
+    {
+        if (p.type == "Ready Stock") stockLeft[p.id] = p.stock;
+    }
+
+    // #### Workshop Backlog Check ####
+    if (!ProductionScheduler::refresh(*store))
+    {
+        printError(store->lastError());
+        system("pause");
+        return;
+    }
+
+    // --------------------------------------------------
+    // Validate & Price Every Row
+    // --------------------------------------------------
+    vector<Order> accepted;
+    vector<int> acceptedLines;
+    vector<pair<int, string>> rejected;
+    string readyArrival;                                  // Same for every Ready Stock row
+    double hoursAhead = ProductionScheduler::hoursAhead(); // Custom rows queue behind earlier rows
+    int rowsRead = 0;
+
+    ImportRecord rec;
+    while (reader.next(rec))
+    {
+        rowsRead++;
+        if (!rec.problem.empty())
+        {
+            rejected.push_back(make_pair(rec.line, rec.problem));
+            continue;
+        }
+        auto field = [&](const char* name) { const string* v = rec.get(name); return v ? *v : string(); };
+
+        // #### Product Check ####
+        const Product* p = nullptr;
+        string pid = field("product_id");
+        if (!pid.empty())
+        {
+            char* end = nullptr;
+            long id = strtol(pid.c_str(), &end, 10);
+            if (*end == '\0') p = catalog->find((int)id);
+        }
+        else
+        {
+            p = catalog->findByName(field("product"));
+        }
+        if (!p)
+        {
+            rejected.push_back(make_pair(rec.line, "Unknown product"));
+            continue;
+        }
+
+        // #### Quantity Check ####
+        string qtyText = field("quantity");
+        char* end = nullptr;
+        long qty = strtol(qtyText.c_str(), &end, 10);
+        if (qtyText.empty() || *end != '\0' || qty <= 0 || qty > 100000)
+        {
+            rejected.push_back(make_pair(rec.line, "Quantity must be a whole number from 1"));
+            continue;
+        }
+
+        Order o{0, "", p->id, p->name, field("customer_name"), field("address"), (int)qty, 0.0, "", "", "Pending",
+                field("size"), field("color"), field("text")};
+        if (o.customerName.empty())
+        {
+            o.customerName = "Walk-in";
+        }
+        if (o.address.empty())
+        {
+            rejected.push_back(make_pair(rec.line, "Address is required"));
+            continue;
+        }
+        string problem = checkOptions(*p, o.custSize, o.custColor, o.custText);
+        if (!problem.empty())
+        {
+            rejected.push_back(make_pair(rec.line, problem));
+            continue;
+        }
+
+        // #### Stock Availability Check ####
+        // Rows claim stock in file order against the cached levels
+        if (p->type == "Ready Stock")
+        {
+            int& left = stockLeft[p->id];
+            if (qty > left)
+            {
+                rejected.push_back(make_pair(rec.line, "Insufficient stock (" + to_string(left) + " left)"));
+                continue;
+            }
+            left -= (int)qty;
+        }
+
+        double subtotal = p->price * qty;
+        o.totalPrice = subtotal - bulkDiscount(subtotal, (int)qty);
+
+        double hours = (double)p->productionHours * qty;
+        if (hours > 0)
+        {
+            o.expectedDate = calculateDate(p->productionHours, (int)qty, hoursAhead);
+            hoursAhead += hours;
+        }
+        else
+        {
+            if (readyArrival.empty()) readyArrival = calculateDate(0, (int)qty, 0.0);
+            o.expectedDate = readyArrival;
+        }
+
+        accepted.push_back(o);
+        acceptedLines.push_back(rec.line);
+    }
+
+    // --------------------------------------------------
+    // Allocate Smart IDs (One Block)
+    // --------------------------------------------------
+    int firstSeq = 0;
+    int seqDay = 0;
+    if (!accepted.empty() && !store->orders().reserveDailySequences((int)accepted.size(), firstSeq, seqDay))
+    {
+        printError(store->lastError());
+        system("pause");
+        return;
+    }
+    for (size_t i = 0; i < accepted.size(); i++)
+    {
+        accepted[i].smartId = generateID(idPrefix(accepted[i].productName), seqDay, firstSeq + (int)i);
+    }
+
+    // --------------------------------------------------
+    // Write in Chunked Transactions
+    // --------------------------------------------------
+    StreamProgress progress("Importing");
+    unsigned long long imported = 0;
+    for (size_t start = 0; start < accepted.size(); start += CHUNK_ROWS)
+    {
+        size_t end = min(accepted.size(), start + CHUNK_ROWS);
+        vector<Order> chunk(accepted.begin() + start, accepted.begin() + end);
+
+        // Ready Stock units taken by this chunk, one decrement per product
+        map<int, int> taken;
+        for (const Order& o : chunk)
+        {
+            if (catalog->find(o.productId)->type == "Ready Stock") taken[o.productId] += o.quantity;
+        }
+
+        PlaceResult result = store->orders().placeBulk(chunk, taken);
+        if (result == PlaceResult::Placed)
+        {
+            imported += chunk.size();
+            for (const pair<const int, int>& t : taken)
+            {
+                ProductCatalog::adjustStock(t.first, -t.second);
+            }
+            for (const Order& o : chunk)
+            {
+                ProductionScheduler::add(o, catalog->find(o.productId)->productionHours);
+            }
+        }
+        else
+        {
+            if (result == PlaceResult::OutOfStock)
+            {
+                ProductCatalog::bump();
+            }
+            string reason = (result == PlaceResult::OutOfStock) ? "Stock changed during import; chunk not written"
+                                                                : "Not written: " + store->lastError();
+            for (size_t i = start; i < end; i++)
+            {
+                rejected.push_back(make_pair(acceptedLines[i], reason));
+            }
+        }
+        progress.tick(imported);
+    }
+    progress.finish(imported);
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+    sort(rejected.begin(), rejected.end());
+
+    // --------------------------------------------------
+    // Summary & Error Report
+    // --------------------------------------------------
+    cout << "\n   [ IMPORT SUMMARY ]\n";
+    cout << "   ──────────────────────────────────────────────────────\n";
+    cout << "   Format       : " << (reader.isJson() ? "JSONL" : "CSV") << "\n";
+    cout << "   Rows Read    : " << rowsRead << "\n";
+    cout << "   Imported     : \033[1;32m" << imported << "\033[0m\n";
+    cout << "   Rejected     : " << (rejected.empty() ? "0" : "\033[1;31m" + to_string(rejected.size()) + "\033[0m") << "\n";
+    cout << "   Time         : " << fixed << setprecision(2) << seconds << " s";
+    if (seconds > 0.0)
+    {
+        cout << " (" << (long long)(rowsRead / seconds * 60.0) << " rows/min)";
+    }
+    cout << "\n";
+
+    if (!rejected.empty())
+    {
+        string reportName = path + ".errors.csv";
+        ofstream report(reportName);
+        report << "Line,Reason\n";
+        for (const pair<int, string>& r : rejected)
+        {
+            string reason = r.second;
+            for (size_t q = reason.find('"'); q != string::npos; q = reason.find('"', q + 2)) reason.insert(q, 1, '"');
+            report << r.first << ",\"" << reason << "\"\n";
+        }
+
+        cout << "\n   First rejected rows:\n";
+        for (size_t i = 0; i < rejected.size() && i < 10; i++)
+        {
+            cout << "    Line " << left << setw(7) << rejected[i].first << " " << rejected[i].second << "\n";
+        }
+        cout << "   Full report: " << reportName << "\n";
+    }
+    system("pause");
+}
+// ============================================================================
+// 14/15 bulkStatusUpdate
+// ============================================================================
+void OrderModule::bulkStatusUpdate(const OrderFilter& filter)
+{
+    // Rows per autocommitted chunk, so long runs never hold locks on the whole selection
+    const int CHUNK_ROWS = 1000;
+
+    cout << "\n";
+    cout << "  ┌────────────────────────────────────────────────────┐\n";
+    cout << "  │ BULK STATUS UPDATE (ENTER 0 ONLY TO CANCEL)        │\n";
+    cout << "  └────────────────────────────────────────────────────┘\n";
+    cout << "    1) Orders Matching the Current Filter\n";
+    cout << "    2) List of Order IDs\n";
+    cout << "   Select ➜ ";
+    int mode = Utils::getValidRange(0, 2);
+
+    // #### Cancel Check ####
+    if (mode == 0)
+    {
+        return;
+    }
+
+    // --------------------------------------------------
+    // Build the Selection
+    // --------------------------------------------------
+    OrderSelection sel{filter, 0, {}};
+    if (mode == 1)
+    {
+        cout << "   Filter      : " << (filter.status.empty() ? "Any Status" : filter.status)
+             << " | " << (filter.fromDate.empty() ? "..." : filter.fromDate)
+             << " to " << (filter.toDate.empty() ? "..." : filter.toDate) << "\n";
+        cout << "   Product ID (0 = Any) ➜ ";
+        sel.productId = Utils::getValidInt();
+    }
+    else
+    {
+        cout << "   Order IDs (separated by commas or spaces) ➜ ";
+        string line = Utils::getValidString();
+        if (line == "0")
+        {
+            return;
+        }
+        for (char& c : line)
+        {
+            if (c == ',' || c == ';' || c == '\t') c = ' ';
+        }
+        stringstream ids(line);
+        string id;
+        while (ids >> id)
+        {
+            sel.smartIds.push_back(id);
+        }
+        sort(sel.smartIds.begin(), sel.smartIds.end());
+        sel.smartIds.erase(unique(sel.smartIds.begin(), sel.smartIds.end()), sel.smartIds.end());
+    }
+
+    cout << "\n   SELECT NEW STATUS\n   ──────────────────\n    1) Processing\n    2) In Production\n    3) Shipped\n    4) Completed\n    5) Cancelled\n    0) Cancel\n   Select ➜ ";
+    static const char* targets[] = {"", "Processing", "In Production", "Shipped", "Completed", "Cancelled"};
+    int t = Utils::getValidRange(0, 5);
+    if (t == 0)
+    {
+        return;
+    }
+    string to = targets[t];
+
+    // --------------------------------------------------
+    // Preview Against the State Machine
+    // --------------------------------------------------
+    map<string, int> counts;
+    if (!store->orders().countByStatus(sel, counts))
+    {
+        printError(store->lastError());
+        system("pause");
+        return;
+    }
+
+    int movable = 0;
+    int found = 0;
+    cout << "\n  ┌──────────────────────┬──────────┬──────────────────────┐\n";
+    cout << "  │ CURRENT STATUS       │ ORDERS   │ RESULT               │\n";
+    cout << "  ├──────────────────────┼──────────┼──────────────────────┤\n";
+    for (const pair<const string, int>& c : counts)
+    {
+        bool allowed = OrderStatus::canMove(c.first, to);
+        string result = allowed ? "-> " + to : (c.first == to ? "Unchanged" : "Not allowed");
+        cout << "  │ " << left << setw(20) << c.first << " │ " << right << setw(8) << c.second << " │ " << left << setw(20) << result << " │\n";
+        found += c.second;
+        if (allowed) movable += c.second;
+    }
+    if (counts.empty())
+    {
+        cout << "  │ " << left << setw(54) << "No matching orders." << " │\n";
+    }
+    cout << "  └──────────────────────┴──────────┴──────────────────────┘\n";
+    if (!sel.smartIds.empty() && found < (int)sel.smartIds.size())
+    {
+        cout << "   " << (sel.smartIds.size() - found) << " order ID(s) not found.\n";
+    }
+
+    // #### Nothing To Move Check ####
+    if (movable == 0)
+    {
+        printError("No selected order can move to " + to + ".");
+        system("pause");
+        return;
+    }
+
+    cout << "   Move " << movable << " order(s) to " << to << "? (1=Yes, 0=No) ➜ ";
+    if (Utils::getValidRange(0, 1) != 1)
+    {
+        return;
+    }
+
+    // --------------------------------------------------
+    // Apply Set-Based in Chunks
+    // --------------------------------------------------
+    long long updated = 0;
+    bool applied = store->orders().bulkUpdateStatus(sel, OrderStatus::sourcesOf(to), to, CHUNK_ROWS, updated);
+
+    // The moved orders are not listed back, so the workshop plan is rebuilt on next use
+    if (updated > 0)
+    {
+        ProductionScheduler::invalidate();
+        OrderSearchIndex::statusChanged(sel, OrderStatus::sourcesOf(to), to);
+    }
+    if (!applied)
+    {
+        printError("Stopped after " + to_string(updated) + " order(s): " + store->lastError());
+        system("pause");
+        return;
+    }
+    printSuccess(to_string(updated) + " order(s) moved to " + to);
+    if (updated < movable)
+    {
+        cout << "    " << (movable - updated) << " order(s) changed meanwhile and were left as they are.\n";
+    }
+    system("pause");
+}
+// ============================================================================
+// 15/15 searchOrders
+// ============================================================================
+string OrderModule::searchOrders()
+{
+    const size_t MAX_HITS = 20;
+
+    // --------------------------------------------------
+    // Search Criteria
+    // --------------------------------------------------
+    cout << "\n   SEARCH ORDERS (0 = Any)\n   ──────────────────\n";
+    OrderQuery query;
+    cout << "   Order ID Starts With ➜ ";
+    query.idPrefix = Utils::getValidString(20);
+    cout << "   Customer Name Has    ➜ ";
+    query.customer = Utils::getValidString(50);
+    if (query.idPrefix == "0") query.idPrefix = "";
+    if (query.customer == "0") query.customer = "";
+    query.filter.fromDate = readDate("   From Date (YYYY-MM-DD, 0 = Any) ➜ ");
+    query.filter.toDate = readDate("   To Date   (YYYY-MM-DD, 0 = Any) ➜ ");
+
+    // #### Index Check ####
+    // Pulls in orders placed since the last search, from any terminal
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+    if (!catalog || !OrderSearchIndex::refresh(*store))
+    {
+        printError(store->lastError());
+        system("pause");
+        return "";
+    }
+
+    vector<Order> hits;
+    size_t total = OrderSearchIndex::search(query, MAX_HITS, hits);
+
+    // #### Result Check ####
+    if (hits.empty())
+    {
+        printError("No matching orders.");
+        system("pause");
+        return "";
+    }
+    if (hits.size() == 1)
+    {
+        return hits.front().smartId;
+    }
+
+    // --------------------------------------------------
+    // Matches (Newest First)
+    // --------------------------------------------------
+    SelectableListing listing;
+    cout << "\n   [ " << total << " MATCH(ES)";
+    if (total > hits.size()) cout << " - NEWEST " << hits.size() << " SHOWN";
+    cout << " ]\n";
+    cout << "  ┌─────┬──────────────────────┬──────────────────────┬──────────────────────┬────────────┬──────────────────────┐\n";
+    cout << "  │  No │ ORDER ID             │ ITEM NAME            │ CUSTOMER             │ DATE       │ STATUS               │\n";
+    cout << "  ├─────┼──────────────────────┼──────────────────────┼──────────────────────┼────────────┼──────────────────────┤\n";
+    for (const Order& o : hits)
+    {
+        const Product* p = catalog->find(o.productId);
+        cout << "  │ "
+             << left << setw(3) << listing.add(o.smartId) << " │ "
+             << left << setw(20) << o.smartId << " │ "
+             << left << setw(20) << (p ? p->name.substr(0, 20) : "-") << " │ "
+             << left << setw(20) << o.customerName.substr(0, 20) << " │ "
+             << left << setw(10) << o.orderDate.substr(0, 10) << " │ "
+             << left << setw(20) << o.status << " │\n";
+    }
+    cout << "  └─────┴──────────────────────┴──────────────────────┴──────────────────────┴────────────┴──────────────────────┘\n";
+
+    return listing.select("\n   Enter Row # (0 to Cancel) ➜ ");
 }
\ No newline at end of file
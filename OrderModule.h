@@ -4,8 +4,10 @@
 #ifndef ORDER_MODULE_H
 #define ORDER_MODULE_H
 
+// Internal Headers
+#include "Repository.h" // Storage-engine neutral data access
+
 // External Libraries
-#include <mysql.h>      // MySQL C API
 #include <string>       // String operations
 #include <iostream>     // I/O operations
 
@@ -17,24 +19,30 @@ public:
     // ============================================================================
     // Constructor
     // ============================================================================
-    OrderModule(MYSQL* c);
+    OrderModule(DataStore* s);
     
     // ============================================================================
     // Public Operations
     // ============================================================================
     void placeOrder();
     void trackOrder();
+    void importOrders();
     
 private:
-    MYSQL* conn; // Database Connection Handler
+    DataStore* store; // Order and product repositories
     
     // ============================================================================
     // Private Helpers
     // ============================================================================
     void showTable();
     string getTodayDate();
-    string calculateDate(int hoursPerUnit, int qty);
-    string generateID(string type, int seq);
+    string calculateDate(int hoursPerUnit, int qty, double hoursAhead);
+    string generateID(string type, int day, int seq);
+    string idPrefix(const string& productName);
+    double bulkDiscount(double subtotal, int qty);
+    OrderFilter promptFilter();
+    string searchOrders();
+    void bulkStatusUpdate(const OrderFilter& filter);
 };
 
 #endif
\ No newline at end of file
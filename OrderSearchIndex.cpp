@@ -0,0 +1,375 @@
+// ============================================================================
+// ORDER SEARCH INDEX IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "OrderSearchIndex.h"
+
+// Standard Libraries
+#include <map>            // Smart ID and date orderings
+#include <unordered_map>  // Name and trigram lookups
+#include <mutex>          // Index lock
+#include <algorithm>      // sort, partial_sort, unique
+#include <cctype>         // Case folding
+#include <cstdint>        // Trigram keys
+
+using namespace std;
+
+// One indexed order; removed rows stay in place so entry numbers never move
+struct IndexEntry
+{
+    long long id;
+    string smartId;
+    int nameId;
+    int productId;
+    int quantity;
+    double totalPrice;
+    string orderDate;
+    string status;
+    bool removed;
+};
+
+static mutex indexLock;                                 // Guards everything below
+static vector<IndexEntry> entries;
+static map<string, size_t> bySmartId;                   // Upper-cased smart_id -> entry
+static multimap<string, size_t> byDate;                 // order_date -> entry
+static vector<string> names;                            // Distinct customer names, as first entered
+static vector<string> foldedNames;                      // Same, lower-cased
+static vector<vector<size_t>> ordersOfName;             // Name id -> entries
+static unordered_map<string, int> nameIdOf;             // Lower-cased name -> name id
+static unordered_map<uint32_t, vector<int>> namesOfTrigram;
+static unordered_map<long long, size_t> byId;           // Order id -> entry
+static long long watermark = 0;                         // Highest id pulled from the table
+static long long feedVersion = 0;                       // Change feed version applied up to
+static const string FEED_READER = "order-search";       // Change feed reader name
+static bool loaded = false;
+
+static string folded(const string& text, bool upper)
+{
+    string out = text;
+    for (char& c : out) c = (char)(upper ? toupper((unsigned char)c) : tolower((unsigned char)c));
+    return out;
+}
+
+static uint32_t trigram(const string& s, size_t at)
+{
+    return ((uint32_t)(unsigned char)s[at] << 16) | ((uint32_t)(unsigned char)s[at + 1] << 8) | (unsigned char)s[at + 2];
+}
+
+// Name id for a customer name, registering it (and its trigrams) on first sight
+static int nameIdFor(const string& name)
+{
+    string key = folded(name, false);
+    unordered_map<string, int>::iterator it = nameIdOf.find(key);
+    if (it != nameIdOf.end())
+    {
+        return it->second;
+    }
+
+    int id = (int)names.size();
+    names.push_back(name);
+    foldedNames.push_back(key);
+    ordersOfName.push_back(vector<size_t>());
+    nameIdOf[key] = id;
+
+    vector<uint32_t> grams;
+    for (size_t i = 0; i + 3 <= key.size(); i++) grams.push_back(trigram(key, i));
+    sort(grams.begin(), grams.end());
+    grams.erase(unique(grams.begin(), grams.end()), grams.end());
+    for (uint32_t g : grams) namesOfTrigram[g].push_back(id);
+    return id;
+}
+
+// Indexes one order unless its smart_id is already there; caller holds indexLock
+static void insertEntry(const Order& o)
+{
+    string key = folded(o.smartId, true);
+    if (bySmartId.count(key) > 0)
+    {
+        return;
+    }
+    size_t at = entries.size();
+    int nameId = nameIdFor(o.customerName);
+    entries.push_back(IndexEntry{o.id, o.smartId, nameId, o.productId, o.quantity, o.totalPrice, o.orderDate, o.status, false});
+    bySmartId[key] = at;
+    byId[o.id] = at;
+    byDate.insert(make_pair(o.orderDate, at));
+    ordersOfName[nameId].push_back(at);
+}
+
+// Brings an indexed order up to its current facts; caller holds indexLock
+static void applyChange(const OrderFact& f)
+{
+    // Orders not indexed yet arrive whole through listAfterId
+    unordered_map<long long, size_t>::iterator it = byId.find(f.id);
+    if (it == byId.end() || entries[it->second].removed)
+    {
+        return;
+    }
+
+    IndexEntry& e = entries[it->second];
+    if (f.removed)
+    {
+        e.removed = true;
+        bySmartId.erase(folded(e.smartId, true));
+        return;
+    }
+
+    // Order dates are set once at placement, so the date index stays as it is
+    e.status = f.status;
+    e.productId = f.productId;
+    e.quantity = f.quantity;
+    e.totalPrice = f.cents / 100.0;
+}
+
+// Drops the index and streams every order in; caller holds indexLock
+static bool loadAll(DataStore& store)
+{
+    entries.clear();
+    bySmartId.clear();
+    byDate.clear();
+    names.clear();
+    foldedNames.clear();
+    ordersOfName.clear();
+    nameIdOf.clear();
+    namesOfTrigram.clear();
+    byId.clear();
+    watermark = 0;
+    loaded = false;
+
+    // The feed's head is read first; anything changed while the orders stream is replayed next time
+    if (!store.orders().latestChangeVersion(FEED_READER, feedVersion))
+    {
+        return false;
+    }
+    bool ok = store.orders().forEachOrder([](const Order& o)
+    {
+        insertEntry(o);
+        watermark = max(watermark, o.id);
+    });
+    loaded = ok;
+    return ok;
+}
+
+// ============================================================================
+// 1/4 refresh
+// ============================================================================
+bool OrderSearchIndex::refresh(DataStore& store)
+{
+    lock_guard<mutex> guard(indexLock);
+
+    // #### First Use ####
+    if (!loaded)
+    {
+        return loadAll(store);
+    }
+
+    // --------------------------------------------------
+    // Catch Up: Changes And Deletes Since (Any Terminal)
+    // --------------------------------------------------
+    // Version 0 asks for a full pass, so from an empty feed it is only made once something changed
+    long long head = feedVersion;
+    if (feedVersion == 0 && !store.orders().latestChangeVersion(FEED_READER, head))
+    {
+        return false;
+    }
+    if (head > 0)
+    {
+        long long version = feedVersion;
+        bool ok = store.orders().forEachChange(FEED_READER, version, [](const OrderFact& f)
+        {
+            applyChange(f);
+        });
+
+        // Facts are idempotent, so a partial catch-up is simply replayed next time
+        if (!ok)
+        {
+            return false;
+        }
+
+        // #### Pruned Feed Check ####
+        // Away long enough for the changes it needed to be pruned: start over
+        if (feedVersion > 0 && version == 0)
+        {
+            return loadAll(store);
+        }
+        feedVersion = version;
+    }
+
+    // --------------------------------------------------
+    // Catch Up: Rows Added Since (Any Terminal)
+    // --------------------------------------------------
+    vector<Order> added;
+    if (!store.orders().listAfterId(watermark, added))
+    {
+        return false;
+    }
+    for (const Order& o : added)
+    {
+        insertEntry(o);
+        watermark = max(watermark, o.id);
+    }
+    return true;
+}
+
+// ============================================================================
+// 2/4 add
+// ============================================================================
+void OrderSearchIndex::add(const Order& o)
+{
+    // The watermark stays put: other terminals' rows below this id are still to be pulled
+    lock_guard<mutex> guard(indexLock);
+    if (loaded)
+    {
+        insertEntry(o);
+    }
+}
+
+// ============================================================================
+// 3/4 statusChanged / remove
+// ============================================================================
+void OrderSearchIndex::statusChanged(const string& smartId, const string& status)
+{
+    lock_guard<mutex> guard(indexLock);
+    map<string, size_t>::iterator it = bySmartId.find(folded(smartId, true));
+    if (it != bySmartId.end())
+    {
+        entries[it->second].status = status;
+    }
+}
+
+void OrderSearchIndex::statusChanged(const OrderSelection& sel, const vector<string>& from, const string& to)
+{
+    lock_guard<mutex> guard(indexLock);
+    auto move = [&](IndexEntry& e)
+    {
+        if (!e.removed && find(from.begin(), from.end(), e.status) != from.end()) e.status = to;
+    };
+
+    // #### Explicit ID List ####
+    if (!sel.smartIds.empty())
+    {
+        for (const string& id : sel.smartIds)
+        {
+            map<string, size_t>::iterator it = bySmartId.find(folded(id, true));
+            if (it != bySmartId.end()) move(entries[it->second]);
+        }
+        return;
+    }
+
+    // Filtered selection: the same predicates over the indexed date range
+    const OrderFilter& f = sel.filter;
+    multimap<string, size_t>::iterator it = f.fromDate.empty() ? byDate.begin() : byDate.lower_bound(f.fromDate);
+    multimap<string, size_t>::iterator end = f.toDate.empty() ? byDate.end() : byDate.upper_bound(f.toDate + " 99");
+    for (; it != end; ++it)
+    {
+        IndexEntry& e = entries[it->second];
+        if (!f.status.empty() && e.status != f.status) continue;
+        if (sel.productId != 0 && e.productId != sel.productId) continue;
+        move(e);
+    }
+}
+
+void OrderSearchIndex::remove(const string& smartId)
+{
+    lock_guard<mutex> guard(indexLock);
+    map<string, size_t>::iterator it = bySmartId.find(folded(smartId, true));
+    if (it != bySmartId.end())
+    {
+        entries[it->second].removed = true;
+        bySmartId.erase(it);
+    }
+}
+
+// ============================================================================
+// 4/4 search
+// ============================================================================
+size_t OrderSearchIndex::search(const OrderQuery& q, size_t limit, vector<Order>& out)
+{
+    lock_guard<mutex> guard(indexLock);
+    out.clear();
+
+    string prefix = folded(q.idPrefix, true);
+    string needle = folded(q.customer, false);
+    const OrderFilter& f = q.filter;
+
+    // Filters every candidate must pass, whichever index produced it
+    auto matches = [&](const IndexEntry& e)
+    {
+        if (e.removed) return false;
+        if (!f.status.empty() && e.status != f.status) return false;
+        if (!f.fromDate.empty() && e.orderDate.compare(0, 10, f.fromDate) < 0) return false;
+        if (!f.toDate.empty() && e.orderDate.compare(0, 10, f.toDate) > 0) return false;
+        return needle.empty() || foldedNames[e.nameId].find(needle) != string::npos;
+    };
+
+    // --------------------------------------------------
+    // Gather Candidates From the Narrowest Index
+    // --------------------------------------------------
+    vector<size_t> hits;
+    size_t total = 0;
+    if (!prefix.empty())
+    {
+        // Smart IDs sharing the prefix are one contiguous key range
+        for (map<string, size_t>::iterator it = bySmartId.lower_bound(prefix);
+             it != bySmartId.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+        {
+            if (matches(entries[it->second])) hits.push_back(it->second);
+        }
+        total = hits.size();
+    }
+    else if (!needle.empty())
+    {
+        // Names holding the rarest trigram of the needle; short needles check every distinct name
+        const vector<int>* shortlist = nullptr;
+        for (size_t i = 0; i + 3 <= needle.size(); i++)
+        {
+            unordered_map<uint32_t, vector<int>>::iterator g = namesOfTrigram.find(trigram(needle, i));
+            if (g == namesOfTrigram.end())
+            {
+                return 0;
+            }
+            if (!shortlist || g->second.size() < shortlist->size()) shortlist = &g->second;
+        }
+
+        size_t nameCount = shortlist ? shortlist->size() : names.size();
+        for (size_t n = 0; n < nameCount; n++)
+        {
+            int nameId = shortlist ? (*shortlist)[n] : (int)n;
+            if (foldedNames[nameId].find(needle) == string::npos) continue;
+            for (size_t at : ordersOfName[nameId])
+            {
+                if (matches(entries[at])) hits.push_back(at);
+            }
+        }
+        total = hits.size();
+    }
+    else
+    {
+        // Date range only: walk the dates newest first, counting every match but keeping limit
+        multimap<string, size_t>::iterator from = f.fromDate.empty() ? byDate.begin() : byDate.lower_bound(f.fromDate);
+        multimap<string, size_t>::iterator to = f.toDate.empty() ? byDate.end() : byDate.upper_bound(f.toDate + " 99");
+        for (multimap<string, size_t>::iterator it = to; it != from;)
+        {
+            --it;
+            const IndexEntry& e = entries[it->second];
+            if (!matches(e)) continue;
+            if (total++ < limit) hits.push_back(it->second);
+        }
+    }
+    // --------------------------------------------------
+    // Newest First, Trimmed to the Limit
+    // --------------------------------------------------
+    size_t shown = min(limit, hits.size());
+    partial_sort(hits.begin(), hits.begin() + shown, hits.end(), [](size_t a, size_t b)
+    {
+        return entries[a].orderDate != entries[b].orderDate ? entries[a].orderDate > entries[b].orderDate
+                                                            : entries[a].id > entries[b].id;
+    });
+    for (size_t i = 0; i < shown; i++)
+    {
+        const IndexEntry& e = entries[hits[i]];
+        out.push_back(Order{e.id, e.smartId, e.productId, "", names[e.nameId], "", e.quantity, e.totalPrice,
+                            e.orderDate, "", e.status, "", "", ""});
+    }
+    return total;
+}
\ No newline at end of file
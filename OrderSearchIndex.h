@@ -0,0 +1,55 @@
+// ============================================================================
+// ORDER SEARCH INDEX HEADER
+// ============================================================================
+#ifndef ORDER_SEARCH_INDEX_H
+#define ORDER_SEARCH_INDEX_H
+
+// Internal Headers
+#include "Repository.h"   // Order records, filters and data store
+
+// Standard Libraries
+#include <string>         // Query text
+#include <vector>         // Hits
+
+using namespace std;
+
+// ============================================================================
+// OrderQuery
+// Every set part must match. Text matching ignores case.
+// ============================================================================
+struct OrderQuery
+{
+    string idPrefix;         // Start of the smart_id, empty = any
+    string customer;         // Part of the customer name, empty = any
+    OrderFilter filter;      // Status and order date range
+};
+
+// ============================================================================
+// OrderSearchIndex
+// Process-wide index for front-desk lookups: smart_ids in an ordered map for
+// prefix ranges, distinct customer names with a trigram index for substring
+// search, and order dates for range scans. The first search loads every
+// order; later ones replay the order change feed past the version applied,
+// so status changes, edits and deletes from any terminal reach the indexed
+// rows, then pull the rows added past the highest id seen. This terminal's
+// own edits are also applied in place as they are made.
+// ============================================================================
+class OrderSearchIndex
+{
+public:
+    // false when a load failed; the store's lastError() says why
+    static bool refresh(DataStore& store);
+
+    // #### Local Edits ####
+    static void add(const Order& o);
+    static void statusChanged(const string& smartId, const string& status);
+    // Mirrors OrderRepository::bulkUpdateStatus on the indexed rows
+    static void statusChanged(const OrderSelection& sel, const vector<string>& from, const string& to);
+    static void remove(const string& smartId);
+
+    // Newest first, at most limit hits carrying the listing columns only
+    // (no address or specs; productName empty). Returns the number of matches.
+    static size_t search(const OrderQuery& q, size_t limit, vector<Order>& out);
+};
+
+#endif
\ No newline at end of file
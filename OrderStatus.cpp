@@ -0,0 +1,69 @@
+// ============================================================================
+// ORDER STATUS IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "OrderStatus.h"
+
+using namespace std;
+
+// ============================================================================
+// Transition Table
+// ============================================================================
+struct Transition
+{
+    const char* from;
+    const char* to;
+};
+
+static const Transition TRANSITIONS[] =
+{
+    {"Pending",          "Processing"},
+    {"Pending",          "In Production"},
+    {"Pending",          "Shipped"},
+    {"Pending",          "Completed"},
+    {"Pending",          "Cancelled"},
+    {"Processing",       "In Production"},
+    {"Processing",       "Shipped"},
+    {"Processing",       "Completed"},
+    {"Processing",       "Cancelled"},
+    {"In Production",    "Shipped"},
+    {"In Production",    "Cancelled"},
+    {"Redo In Progress", "In Production"},
+    {"Redo In Progress", "Shipped"},
+    {"Redo In Progress", "Cancelled"},
+    {"Shipped",          "Completed"},
+};
+
+// ============================================================================
+// 1/3 all
+// ============================================================================
+const vector<string>& OrderStatus::all()
+{
+    static const vector<string> statuses = {"Pending", "Processing", "In Production", "Shipped", "Completed", "Cancelled", "Refunded", "Redo In Progress"};
+    return statuses;
+}
+
+// ============================================================================
+// 2/3 canMove
+// ============================================================================
+bool OrderStatus::canMove(const string& from, const string& to)
+{
+    for (const Transition& t : TRANSITIONS)
+    {
+        if (from == t.from && to == t.to) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// 3/3 sourcesOf
+// ============================================================================
+vector<string> OrderStatus::sourcesOf(const string& to)
+{
+    vector<string> sources;
+    for (const Transition& t : TRANSITIONS)
+    {
+        if (to == t.to) sources.push_back(t.from);
+    }
+    return sources;
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+// ============================================================================
+// ORDER STATUS HEADER
+// ============================================================================
+#ifndef ORDER_STATUS_H
+#define ORDER_STATUS_H
+
+// Standard Libraries
+#include <string>       // Status names
+#include <vector>       // Status lists
+
+using namespace std;
+
+// ============================================================================
+// OrderStatus
+// The order lifecycle as an explicit state machine. Every status change made
+// from the tracker, for one order or in bulk, must be a listed transition.
+// Refunded and Redo In Progress are entered through the issue workflow.
+// ============================================================================
+class OrderStatus
+{
+public:
+    static const vector<string>& all();
+    static bool canMove(const string& from, const string& to);
+    static vector<string> sourcesOf(const string& to);   // Statuses allowed to move to 'to'
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+// ============================================================================
+// PRODUCT CATALOG IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "ProductCatalog.h"
+
+// Standard Libraries
+#include <atomic>      // Lock-free version checks
+#include <mutex>       // Snapshot swap
+#include <cctype>      // Case folding
+
+using namespace std;
+
+const int ProductCatalog::MAX_AGE_SECONDS;  // chrono::seconds binds it by reference
+
+static atomic<unsigned long> catalogVersion(1);        // Bumped on every catalog edit
+static mutex snapshotLock;                             // Guards current
+static shared_ptr<const CatalogSnapshot> current;      // Latest load (nullptr until first use)
+
+// Lower-cased copy for name lookups
+static string nameKey(const string& name)
+{
+    string key = name;
+    for (char& c : key) c = (char)tolower((unsigned char)c);
+    return key;
+}
+
+// ============================================================================
+// 1/4 CatalogSnapshot::find / findByName
+// ============================================================================
+const Product* CatalogSnapshot::find(int id) const
+{
+    unordered_map<int, size_t>::const_iterator it = byId.find(id);
+    return (it == byId.end()) ? nullptr : &products[it->second];
+}
+
+const Product* CatalogSnapshot::findByName(const string& name) const
+{
+    unordered_map<string, size_t>::const_iterator it = byName.find(nameKey(name));
+    return (it == byName.end()) ? nullptr : &products[it->second];
+}
+
+// ============================================================================
+// 2/4 get
+// ============================================================================
+shared_ptr<const CatalogSnapshot> ProductCatalog::get(ProductRepository& repo)
+{
+    unsigned long wanted = catalogVersion.load();
+    {
+        // #### Cache Hit Check ####
+        lock_guard<mutex> guard(snapshotLock);
+        if (current && current->version == wanted &&
+            chrono::steady_clock::now() - current->loaded < chrono::seconds(MAX_AGE_SECONDS))
+        {
+            return current;
+        }
+    }
+
+    // --------------------------------------------------
+    // Reload (Outside the Lock)
+    // --------------------------------------------------
+    shared_ptr<CatalogSnapshot> fresh = make_shared<CatalogSnapshot>();
+    if (!repo.listAll(fresh->products))
+    {
+        return nullptr;
+    }
+    fresh->version = wanted;
+    fresh->loaded = chrono::steady_clock::now();
+    for (size_t i = 0; i < fresh->products.size(); i++)
+    {
+        fresh->byId[fresh->products[i].id] = i;
+        fresh->byName[nameKey(fresh->products[i].name)] = i;
+    }
+
+    // A bump during the load leaves this snapshot already out of date; keep it for this caller only
+    lock_guard<mutex> guard(snapshotLock);
+    if (catalogVersion.load() == wanted)
+    {
+        current = fresh;
+    }
+    return fresh;
+}
+
+// ============================================================================
+// 3/4 bump / version
+// ============================================================================
+void ProductCatalog::bump()
+{
+    catalogVersion++;
+}
+
+unsigned long ProductCatalog::version()
+{
+    return catalogVersion.load();
+}
+
+// ============================================================================
+// 4/4 adjustStock
+// ============================================================================
+void ProductCatalog::adjustStock(int productId, int delta)
+{
+    // Copy-on-write: readers keep the snapshot they already hold
+    lock_guard<mutex> guard(snapshotLock);
+    if (!current)
+    {
+        return;
+    }
+    unordered_map<int, size_t>::const_iterator it = current->byId.find(productId);
+    if (it == current->byId.end())
+    {
+        return;
+    }
+
+    shared_ptr<CatalogSnapshot> copy = make_shared<CatalogSnapshot>(*current);
+    copy->products[it->second].stock += delta;
+    current = copy;
+}
\ No newline at end of file
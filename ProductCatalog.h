@@ -0,0 +1,55 @@
+// ============================================================================
+// PRODUCT CATALOG HEADER
+// ============================================================================
+#ifndef PRODUCT_CATALOG_H
+#define PRODUCT_CATALOG_H
+
+// Internal Headers
+#include "Repository.h"   // Product records and repository
+
+// Standard Libraries
+#include <string>         // Name keys
+#include <vector>         // Products in id order
+#include <unordered_map>  // Id / name indexes
+#include <memory>         // Shared snapshots
+#include <chrono>         // Snapshot age
+
+using namespace std;
+
+// ============================================================================
+// CatalogSnapshot
+// One immutable load of the products table with its lookups. Screens hold
+// the shared pointer while they draw, so a reload never changes it under them.
+// ============================================================================
+struct CatalogSnapshot
+{
+    unsigned long version;                  // Catalog version it was loaded at
+    chrono::steady_clock::time_point loaded;
+    vector<Product> products;               // Id order, as listAll returns them
+    unordered_map<int, size_t> byId;
+    unordered_map<string, size_t> byName;   // Lower-cased name
+
+    const Product* find(int id) const;
+    const Product* findByName(const string& name) const;
+};
+
+// ============================================================================
+// ProductCatalog
+// Process-wide product cache shared by every screen. Reads return the cached
+// snapshot unless the version moved (bump() after any catalog edit) or it is
+// older than MAX_AGE_SECONDS, which bounds staleness from other terminals.
+// Committed stock changes made here are applied in place without a reload.
+// ============================================================================
+class ProductCatalog
+{
+public:
+    static const int MAX_AGE_SECONDS = 30;
+
+    // nullptr when a needed reload failed; the store's lastError() says why
+    static shared_ptr<const CatalogSnapshot> get(ProductRepository& repo);
+    static void bump();
+    static void adjustStock(int productId, int delta);
+    static unsigned long version();
+};
+
+#endif
\ No newline at end of file
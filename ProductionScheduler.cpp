@@ -0,0 +1,274 @@
+// ============================================================================
+// PRODUCTION SCHEDULER IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "ProductionScheduler.h"
+#include "ProductCatalog.h"   // Production hours per product
+#include "Format.h"           // order_date text
+
+// Standard Libraries
+#include <map>            // Priority-ordered queue
+#include <unordered_map>  // Slot and per-product indexes
+#include <mutex>          // Plan lock
+#include <atomic>         // Lock-free capacity reads
+#include <chrono>         // Backlog age
+#include <tuple>          // Key ordering
+#include <algorithm>      // min, max
+
+using namespace std;
+
+const int ProductionScheduler::MAX_AGE_SECONDS;  // chrono::seconds binds it by reference
+
+// Queue position: lower rank first, then oldest, then smart_id for a total order
+struct JobKey
+{
+    int rank;
+    string orderDate;
+    string smartId;
+
+    bool operator<(const JobKey& other) const
+    {
+        return tie(rank, orderDate, smartId) < tie(other.rank, other.orderDate, other.smartId);
+    }
+};
+
+struct QueuedJob
+{
+    int productId;
+    int quantity;
+    string status;
+};
+
+// A std::map rather than std::priority_queue: cancelled orders leave from the middle
+static mutex planLock;                                  // Guards everything below
+static map<JobKey, QueuedJob> backlogQueue;             // Backlog in work order
+static unordered_map<string, JobKey> slotOf;            // smart_id -> queue key
+static unordered_map<int, int> unitHours;               // product_id -> hours per unit
+static unordered_map<int, long long> unitsQueued;       // product_id -> units in the backlog
+static long long totalHours = 0;                        // Sum of units * unit hours
+static bool loaded = false;
+static chrono::steady_clock::time_point loadedAt;
+static atomic<int> workshopHours(ProductionScheduler::DEFAULT_DAILY_HOURS);
+
+// Work order of a backlog status; -1 = not in the backlog
+static int rankOf(const string& status)
+{
+    if (status == "In Production")    return 0;
+    if (status == "Redo In Progress") return 1;
+    if (status == "Processing")       return 2;
+    if (status == "Pending")          return 3;
+    return -1;
+}
+
+static const vector<string>& backlogStatuses()
+{
+    static const vector<string> statuses = {"In Production", "Redo In Progress", "Processing", "Pending"};
+    return statuses;
+}
+
+// Local time as "YYYY-MM-DD HH:MM:SS", the order_date a new order is given
+static string nowText()
+{
+    return Format::stamp(time(0));
+}
+
+// Queues one job; caller holds planLock and has set the product's unit hours
+static void enqueue(const JobKey& key, const QueuedJob& job)
+{
+    if (!backlogQueue.insert(make_pair(key, job)).second)
+    {
+        return;
+    }
+    slotOf[key.smartId] = key;
+    unitsQueued[job.productId] += job.quantity;
+    totalHours += (long long)job.quantity * unitHours[job.productId];
+}
+
+// ============================================================================
+// 1/5 refresh / invalidate
+// ============================================================================
+bool ProductionScheduler::refresh(DataStore& store)
+{
+    {
+        // #### Plan Still Current Check ####
+        lock_guard<mutex> guard(planLock);
+        if (loaded && chrono::steady_clock::now() - loadedAt < chrono::seconds(MAX_AGE_SECONDS))
+        {
+            return true;
+        }
+    }
+
+    // --------------------------------------------------
+    // Load Backlog (Outside the Lock)
+    // --------------------------------------------------
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store.products());
+    if (!catalog)
+    {
+        return false;
+    }
+    vector<Order> backlog;
+    if (!store.orders().listByStatus(backlogStatuses(), backlog))
+    {
+        return false;
+    }
+
+    // --------------------------------------------------
+    // Rebuild the Queue
+    // --------------------------------------------------
+    lock_guard<mutex> guard(planLock);
+    backlogQueue.clear();
+    slotOf.clear();
+    unitHours.clear();
+    unitsQueued.clear();
+    totalHours = 0;
+    slotOf.reserve(backlog.size());
+    for (const Product& p : catalog->products)
+    {
+        unitHours[p.id] = p.productionHours;
+    }
+    for (const Order& o : backlog)
+    {
+        enqueue(JobKey{rankOf(o.status), o.orderDate, o.smartId}, QueuedJob{o.productId, o.quantity, o.status});
+    }
+    loaded = true;
+    loadedAt = chrono::steady_clock::now();
+    return true;
+}
+
+void ProductionScheduler::invalidate()
+{
+    lock_guard<mutex> guard(planLock);
+    loaded = false;
+}
+
+// ============================================================================
+// 2/5 add / statusChanged
+// ============================================================================
+void ProductionScheduler::add(const Order& o, int hoursPerUnit)
+{
+    int rank = rankOf(o.status);
+    lock_guard<mutex> guard(planLock);
+
+    // An unloaded plan picks the order up from the table on its next refresh
+    if (!loaded || rank < 0 || slotOf.count(o.smartId) > 0)
+    {
+        return;
+    }
+
+    // Hours entered with the order win over what the plan last saw
+    long long& units = unitsQueued[o.productId];
+    int& hours = unitHours[o.productId];
+    totalHours += units * (hoursPerUnit - hours);
+    hours = hoursPerUnit;
+
+    enqueue(JobKey{rank, o.orderDate.empty() ? nowText() : o.orderDate, o.smartId},
+            QueuedJob{o.productId, o.quantity, o.status});
+}
+
+void ProductionScheduler::statusChanged(const string& smartId, const string& status)
+{
+    int rank = rankOf(status);
+    lock_guard<mutex> guard(planLock);
+    if (!loaded)
+    {
+        return;
+    }
+
+    unordered_map<string, JobKey>::iterator slot = slotOf.find(smartId);
+    if (slot == slotOf.end())
+    {
+        // Re-entering the backlog (e.g. a redo): quantity is unknown here, so reload
+        if (rank >= 0) loaded = false;
+        return;
+    }
+
+    map<JobKey, QueuedJob>::iterator it = backlogQueue.find(slot->second);
+    QueuedJob job = it->second;
+    JobKey key = it->first;
+    backlogQueue.erase(it);
+    slotOf.erase(slot);
+
+    // #### Left the Backlog ####
+    if (rank < 0)
+    {
+        unitsQueued[job.productId] -= job.quantity;
+        totalHours -= (long long)job.quantity * unitHours[job.productId];
+        return;
+    }
+
+    // Same work, new place in the queue
+    key.rank = rank;
+    job.status = status;
+    backlogQueue.insert(make_pair(key, job));
+    slotOf[smartId] = key;
+}
+
+// ============================================================================
+// 3/5 productHoursChanged
+// ============================================================================
+void ProductionScheduler::productHoursChanged(int productId, int hoursPerUnit)
+{
+    lock_guard<mutex> guard(planLock);
+    if (!loaded)
+    {
+        return;
+    }
+
+    // Every queued unit of the product moves by the difference; slot times follow on read
+    int& hours = unitHours[productId];
+    totalHours += unitsQueued[productId] * (hoursPerUnit - hours);
+    hours = hoursPerUnit;
+}
+
+// ============================================================================
+// 4/5 setDailyHours / dailyHours
+// ============================================================================
+void ProductionScheduler::setDailyHours(int hours)
+{
+    workshopHours = max(1, min(24, hours));
+}
+
+int ProductionScheduler::dailyHours()
+{
+    return workshopHours.load();
+}
+
+// ============================================================================
+// 5/5 hoursAhead / size / finishTime / plan
+// ============================================================================
+double ProductionScheduler::hoursAhead()
+{
+    lock_guard<mutex> guard(planLock);
+    return (double)totalHours;
+}
+
+size_t ProductionScheduler::size()
+{
+    lock_guard<mutex> guard(planLock);
+    return backlogQueue.size();
+}
+
+time_t ProductionScheduler::finishTime(double workHours)
+{
+    // Ready stock (no work) still takes a day to pack
+    double seconds = (workHours > 0) ? workHours / dailyHours() * 24 * 3600 : 24 * 3600;
+    return time(0) + (time_t)seconds;
+}
+
+vector<ScheduledJob> ProductionScheduler::plan(size_t limit)
+{
+    lock_guard<mutex> guard(planLock);
+    vector<ScheduledJob> out;
+    out.reserve(min(limit, backlogQueue.size()));
+
+    // Each slot ends when all the work in front of it and its own is done
+    long long done = 0;
+    for (map<JobKey, QueuedJob>::const_iterator it = backlogQueue.begin(); it != backlogQueue.end() && out.size() < limit; ++it)
+    {
+        double hours = (double)it->second.quantity * unitHours[it->second.productId];
+        done += (long long)hours;
+        out.push_back(ScheduledJob{it->first.smartId, it->second.productId, it->second.quantity, it->second.status,
+                                   it->first.orderDate, hours, finishTime((double)done)});
+    }
+    return out;
+}
\ No newline at end of file
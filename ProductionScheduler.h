@@ -0,0 +1,68 @@
+// ============================================================================
+// PRODUCTION SCHEDULER HEADER
+// ============================================================================
+#ifndef PRODUCTION_SCHEDULER_H
+#define PRODUCTION_SCHEDULER_H
+
+// Internal Headers
+#include "Repository.h"   // Order records and data store
+
+// Standard Libraries
+#include <string>         // Smart IDs, statuses
+#include <vector>         // Plan listings
+#include <ctime>          // Finish times
+
+using namespace std;
+
+// ============================================================================
+// ScheduledJob
+// One backlog order in its workshop slot. finish is when the last unit is
+// done if the workshop works the queue front to back at the daily capacity.
+// ============================================================================
+struct ScheduledJob
+{
+    string smartId;
+    int productId;
+    int quantity;
+    string status;
+    string orderDate;
+    double hours;            // quantity * the product's current production hours
+    time_t finish;
+};
+
+// ============================================================================
+// ProductionScheduler
+// Process-wide plan of the workshop backlog (Pending, Processing, In
+// Production and Redo In Progress orders), worked in priority order: jobs
+// already in production, then redos, then the rest oldest first. Only the
+// running total of queued hours is kept, so placing, cancelling and product
+// hour changes re-plan in constant or log time; slot times are summed on read.
+// The backlog is reloaded after invalidate() or once older than
+// MAX_AGE_SECONDS, which bounds drift from other terminals.
+// ============================================================================
+class ProductionScheduler
+{
+public:
+    static const int DEFAULT_DAILY_HOURS = 8;
+    static const int MAX_AGE_SECONDS = 60;
+
+    // #### Backlog ####
+    // false when a needed reload failed; the store's lastError() says why
+    static bool refresh(DataStore& store);
+    static void invalidate();
+    static void add(const Order& o, int hoursPerUnit);
+    static void statusChanged(const string& smartId, const string& status);  // Empty status = deleted
+    static void productHoursChanged(int productId, int hoursPerUnit);
+
+    // #### Capacity ####
+    static void setDailyHours(int hours);
+    static int dailyHours();
+
+    // #### Plan ####
+    static double hoursAhead();                   // Work queued in front of a new order
+    static size_t size();
+    static time_t finishTime(double workHours);   // Now plus work at daily capacity, at least one day
+    static vector<ScheduledJob> plan(size_t limit);
+};
+
+#endif
\ No newline at end of file
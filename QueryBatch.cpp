@@ -0,0 +1,166 @@
+// ============================================================================
+// QUERY BATCH IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "QueryBatch.h"
+#include "QueryMetrics.h"    // Per-call-site latency recording
+#include "SlowQueryLog.h"    // Slow batch capture
+
+// Standard Libraries
+#include <chrono>      // Execution timing
+
+using namespace std;
+
+// ============================================================================
+// 1/6 QueryBatch (Constructor)
+// ============================================================================
+QueryBatch::QueryBatch(MYSQL* c, const char* callSite)
+{
+    conn = c;
+    site = callSite;
+    idempotent = false;
+}
+
+// ============================================================================
+// 2/6 ~QueryBatch (Destructor)
+// ============================================================================
+QueryBatch::~QueryBatch()
+{
+    for (MYSQL_RES* res : results)
+    {
+        if (res)
+        {
+            mysql_free_result(res);
+        }
+    }
+}
+
+// ============================================================================
+// 3/6 add / quote
+// ============================================================================
+size_t QueryBatch::add(const string& sql)
+{
+    statements.push_back(sql);
+    return statements.size() - 1;
+}
+
+string QueryBatch::quote(const string& text)
+{
+    vector<char> escaped(text.length() * 2 + 1);
+    unsigned long n = mysql_real_escape_string(conn, escaped.data(), text.c_str(), text.length());
+    return "'" + string(escaped.data(), n) + "'";
+}
+
+// ============================================================================
+// 4/6 markIdempotent / execute
+// ============================================================================
+void QueryBatch::markIdempotent()
+{
+    idempotent = true;
+}
+
+bool QueryBatch::execute()
+{
+    results.assign(statements.size(), nullptr);
+    affected.assign(statements.size(), 0);
+    lastError.clear();
+
+    string sql;
+    for (size_t i = 0; i < statements.size(); i++)
+    {
+        sql += (i ? "; " : "") + statements[i];
+    }
+
+    // --------------------------------------------------
+    // One Round Trip For The Whole Batch
+    // --------------------------------------------------
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    bool ok = !mysql_real_query(conn, sql.c_str(), sql.length());
+
+    // Taken before anything else runs on the connection, which would clear it
+    if (!ok)
+    {
+        lastError = mysql_error(conn);
+    }
+
+    // #### Lost Connection Check ####
+    if (!ok && QueryExecutor::recover(conn))
+    {
+        if (!idempotent)
+        {
+            lastError = QueryExecutor::errorText(conn);
+            QueryMetrics::record(site, 0, 0, 0, true);
+            return false;
+        }
+        start = chrono::steady_clock::now();
+        ok = !mysql_real_query(conn, sql.c_str(), sql.length());
+        lastError = ok ? "" : mysql_error(conn);
+    }
+    uint64_t rows = 0;
+    bool buffered = false;      // A result set came back; its bytes are not measured
+
+    // --------------------------------------------------
+    // Collect Every Result Set
+    // --------------------------------------------------
+    // The loop must drain all results, otherwise the connection stays out of sync
+    size_t idx = 0;
+    int status = ok ? 0 : 1;
+    while (status == 0)
+    {
+        MYSQL_RES* res = mysql_store_result(conn);
+        if (idx < results.size())
+        {
+            results[idx] = res;
+            buffered = buffered || res != nullptr;
+            affected[idx] = res ? mysql_num_rows(res) : mysql_affected_rows(conn);
+            rows += affected[idx];
+        }
+        else if (res)
+        {
+            mysql_free_result(res);
+        }
+        idx++;
+
+        // 0 = another result follows, -1 = done, >0 = a later statement failed
+        status = mysql_next_result(conn);
+    }
+
+    if (status > 0)
+    {
+        ok = false;
+        lastError = mysql_error(conn);
+        if (QueryExecutor::recover(conn))
+        {
+            lastError = QueryExecutor::errorText(conn);
+        }
+    }
+
+    uint64_t micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    QueryMetrics::record(site, micros, rows, buffered ? QueryMetrics::BYTES_UNKNOWN : 0, !ok);
+    if (SlowQueryLog::isSlow(micros))
+    {
+        SlowQueryLog::capture(site, sql, vector<string>(), micros);
+    }
+    return ok;
+}
+
+// ============================================================================
+// 5/6 result / affectedRows
+// ============================================================================
+MYSQL_RES* QueryBatch::result(size_t idx)
+{
+    return (idx < results.size()) ? results[idx] : nullptr;
+}
+
+my_ulonglong QueryBatch::affectedRows(size_t idx)
+{
+    return (idx < affected.size()) ? affected[idx] : 0;
+}
+
+// ============================================================================
+// 6/6 error
+// ============================================================================
+string QueryBatch::error()
+{
+    return lastError;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+// ============================================================================
+// QUERY BATCH HEADER
+// ============================================================================
+#ifndef QUERY_BATCH_H
+#define QUERY_BATCH_H
+
+// External Libraries
+#include <mysql.h>      // MySQL C API (multi-statement results)
+#include <string>       // Statement text
+#include <vector>       // Per-statement results
+
+using namespace std;
+
+// ============================================================================
+// QueryBatch
+// Sends several statements in one packet and walks the result sets with
+// mysql_next_result. Runs only on the pool's batch connection (acquireBatch,
+// opened with CLIENT_MULTI_STATEMENTS), so ordinary queries on the other
+// pooled connections never run a second statement that slipped in after a
+// ';'. The server stops at the first
+// failing statement; results of the statements before it stay available.
+// Values from user input must go through quote() before being added.
+// After a lost connection only batches marked idempotent are re-sent.
+// ============================================================================
+class QueryBatch
+{
+public:
+    // ============================================================================
+    // Constructor / Destructor
+    // ============================================================================
+    QueryBatch(MYSQL* c, const char* callSite = "QueryBatch");
+    ~QueryBatch();
+
+    // ============================================================================
+    // Building
+    // ============================================================================
+    size_t add(const string& sql);
+    string quote(const string& text);
+
+    // ============================================================================
+    // Execution & Results (index as returned by add)
+    // ============================================================================
+    void markIdempotent();
+    bool execute();
+    MYSQL_RES* result(size_t idx);
+    my_ulonglong affectedRows(size_t idx);
+    string error();
+
+private:
+    MYSQL* conn;                  // Batch connection (opened with CLIENT_MULTI_STATEMENTS)
+    const char* site;             // Call-site name for QueryMetrics
+    vector<string> statements;    // Statements in send order
+    vector<MYSQL_RES*> results;   // Buffered result per statement (nullptr if none)
+    vector<my_ulonglong> affected;// Rows affected / returned per statement
+    string lastError;             // First error reported by the server
+    bool idempotent;              // Whole batch may be re-sent after a reconnect
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,402 @@
+// ============================================================================
+// QUERY METRICS IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "QueryMetrics.h"
+#include "SlowQueryLog.h"   // Slow statement capture
+#include "DatabaseConnection.h" // Lost-connection recovery
+#include "Format.h"         // Dump timestamp
+
+// Standard Libraries
+#include <iostream>    // Summary output (cout)
+#include <iomanip>     // Formatting (setw, setprecision)
+#include <fstream>     // Metrics dump file
+#include <sstream>     // KB cell text
+#include <map>         // Site registry (sorted for stable output)
+#include <mutex>       // Registry locking
+#include <chrono>      // Wall-clock timing
+#include <ctime>       // Dump timestamp
+#include <cstring>     // memset
+#include <cstdlib>     // System calls
+
+using namespace std;
+
+// ============================================================================
+// SiteStats / Pending (File-Local)
+// ============================================================================
+struct SiteStats
+{
+    uint64_t calls = 0;         // Executions recorded
+    uint64_t errors = 0;        // Executions that failed
+    uint64_t rows = 0;          // Rows returned or affected
+    uint64_t bytes = 0;         // Result bytes transferred, over the measured calls
+    uint64_t unmeasured = 0;    // Calls whose result bytes are unknown (buffered results)
+    uint64_t totalMicros = 0;   // Sum of wall time
+    uint64_t maxMicros = 0;     // Slowest execution
+    LatencyHistogram latency;   // Wall time distribution
+};
+
+struct Pending
+{
+    string site;                                // Call site awaiting store()
+    string sql;                                 // Statement text (slow-query log)
+    chrono::steady_clock::time_point start;     // When run() was called
+};
+
+static map<string, SiteStats> sites;
+static map<MYSQL*, Pending> pending;
+static map<MYSQL*, bool> retryable;   // Connections whose last statement was cut off by a reconnect
+static mutex metricsLock;
+
+// ============================================================================
+// 1/14 LatencyHistogram (Constructor)
+// ============================================================================
+LatencyHistogram::LatencyHistogram()
+{
+    memset(counts, 0, sizeof(counts));
+    total = 0;
+}
+
+// ============================================================================
+// 2/14 bucketFor / upperBound
+// ============================================================================
+int LatencyHistogram::bucketFor(uint64_t micros)
+{
+    // Exact buckets for the first 32 microseconds
+    if (micros < 32)
+    {
+        return (int)micros;
+    }
+
+    // Keep the top 5 significant bits: 16 linear sub-buckets per power of two
+    int msb = 63 - __builtin_clzll(micros);
+    int shift = msb - 4;
+    int index = shift * 16 + (int)(micros >> shift);
+    return (index < BUCKETS) ? index : BUCKETS - 1;
+}
+
+uint64_t LatencyHistogram::upperBound(int bucket)
+{
+    if (bucket < 32)
+    {
+        return (uint64_t)bucket;
+    }
+    int shift = bucket / 16 - 1;
+    uint64_t top = (uint64_t)(bucket % 16 + 16);
+    return ((top + 1) << shift) - 1;
+}
+
+// ============================================================================
+// 3/14 record / count
+// ============================================================================
+void LatencyHistogram::record(uint64_t micros)
+{
+    counts[bucketFor(micros)]++;
+    total++;
+}
+
+uint64_t LatencyHistogram::count() const
+{
+    return total;
+}
+
+// ============================================================================
+// 4/14 percentile
+// ============================================================================
+uint64_t LatencyHistogram::percentile(double pct) const
+{
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    // --------------------------------------------------
+    // Walk Buckets Until The Rank Is Covered
+    // --------------------------------------------------
+    uint64_t rank = (uint64_t)(pct / 100.0 * total + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > total) rank = total;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            return upperBound(i);
+        }
+    }
+    return upperBound(BUCKETS - 1);
+}
+
+// ============================================================================
+// 5/14 QueryMetrics::record
+// ============================================================================
+void QueryMetrics::record(const string& site, uint64_t micros, uint64_t rows, uint64_t bytes, bool failed)
+{
+    lock_guard<mutex> guard(metricsLock);
+    SiteStats& s = sites[site];
+
+    s.calls++;
+    s.rows += rows;
+    if (bytes == BYTES_UNKNOWN) s.unmeasured++;
+    else                        s.bytes += bytes;
+    s.totalMicros += micros;
+    if (micros > s.maxMicros) s.maxMicros = micros;
+    if (failed) s.errors++;
+    s.latency.record(micros);
+}
+
+// ============================================================================
+// 6/14 QueryMetrics::addBytes
+// ============================================================================
+void QueryMetrics::addBytes(const string& site, uint64_t bytes)
+{
+    // Used by readers that only learn the byte count while fetching rows
+    lock_guard<mutex> guard(metricsLock);
+    sites[site].bytes += bytes;
+}
+
+// ============================================================================
+// 7/14 QueryMetrics::printSummary
+// ============================================================================
+void QueryMetrics::printSummary()
+{
+    lock_guard<mutex> guard(metricsLock);
+
+    // Caller pauses afterwards, so the registry lock is never held on input
+    system("cls");
+    cout << "\n";
+    cout << "  ╔══════════════════════════════════════════════════════╗\n";
+    cout << "  ║              QUERY PERFORMANCE SUMMARY               ║\n";
+    cout << "  ╚══════════════════════════════════════════════════════╝\n";
+    cout << "\n";
+    cout << "  ┌────────────────────────────────────┬─────────┬───────────┬───────────┬───────────┬───────────┬───────────┬──────┐\n";
+    cout << "  │ CALL SITE                          │ CALLS   │ P50 (ms)  │ P99 (ms)  │ MAX (ms)  │ ROWS      │ KB        │ ERR  │\n";
+    cout << "  ├────────────────────────────────────┼─────────┼───────────┼───────────┼───────────┼───────────┼───────────┼──────┤\n";
+
+    if (sites.empty())
+    {
+        cout << "  │ " << left << setw(111) << "No queries recorded this session." << " │\n";
+    }
+
+    // --------------------------------------------------
+    // One Row Per Call Site
+    // --------------------------------------------------
+    for (const auto& entry : sites)
+    {
+        const SiteStats& s = entry.second;
+        string name = entry.first;
+        if (name.length() > 34) name = name.substr(0, 31) + "...";
+
+        // "n/a" when no call had its bytes measured; "*" when only some did
+        ostringstream kb;
+        bool measured = s.unmeasured == 0 || s.unmeasured < s.calls;
+        if (!measured) kb << "n/a";
+        else                         kb << fixed << setprecision(2) << s.bytes / 1024.0 << (s.unmeasured ? "*" : "");
+
+        cout << "  │ " << left << setw(34) << name << " │ "
+             << right << setw(7) << s.calls << " │ "
+             << fixed << setprecision(2)
+             << right << setw(9) << s.latency.percentile(50) / 1000.0 << " │ "
+             << right << setw(9) << s.latency.percentile(99) / 1000.0 << " │ "
+             << right << setw(9) << s.maxMicros / 1000.0 << " │ "
+             << right << setw(9) << s.rows << " │ "
+             << right << setw(9) << kb.str() << " │ "
+             << right << setw(4) << s.errors << " │\n";
+    }
+    cout << "  └────────────────────────────────────┴─────────┴───────────┴───────────┴───────────┴───────────┴───────────┴──────┘\n";
+    cout << "   [INFO] Percentiles are bucket upper bounds (±6%).\n";
+    cout << "   [INFO] KB n/a = buffered results, not measured; * = only some calls measured.\n";
+}
+
+// ============================================================================
+// 8/14 QueryMetrics::dumpToFile
+// ============================================================================
+bool QueryMetrics::dumpToFile(const string& filename)
+{
+    lock_guard<mutex> guard(metricsLock);
+
+    ofstream out(filename, ios::app);
+    if (!out)
+    {
+        return false;
+    }
+
+    // --------------------------------------------------
+    // Session Header
+    // --------------------------------------------------
+    char stamp[Format::STAMP_LEN + 1];
+    Format::writeStamp(stamp, time(0));
+    out << "# session dump " << stamp << "\n";
+    out << "site,calls,errors,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,rows,bytes,bytes_unmeasured_calls\n";
+
+    // --------------------------------------------------
+    // Per-Site Lines
+    // --------------------------------------------------
+    out << fixed << setprecision(3);
+    for (const auto& entry : sites)
+    {
+        const SiteStats& s = entry.second;
+        double mean = s.calls ? (double)s.totalMicros / s.calls / 1000.0 : 0.0;
+        out << entry.first << "," << s.calls << "," << s.errors << "," << mean << ","
+            << s.latency.percentile(50) / 1000.0 << ","
+            << s.latency.percentile(90) / 1000.0 << ","
+            << s.latency.percentile(99) / 1000.0 << ","
+            << s.maxMicros / 1000.0 << "," << s.rows << ","
+            << (s.unmeasured > 0 && s.unmeasured == s.calls ? string() : to_string(s.bytes)) << "," << s.unmeasured << "\n";
+    }
+    out << "\n";
+    return true;
+}
+
+// ============================================================================
+// 9/14 elapsedMicros (Local Helper)
+// ============================================================================
+static uint64_t elapsedMicros(chrono::steady_clock::time_point start)
+{
+    return (uint64_t)chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+}
+
+// ============================================================================
+// 10/14 QueryExecutor::run
+// ============================================================================
+int QueryExecutor::run(MYSQL* conn, const string& sql, const char* site)
+{
+    forget(conn);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int rc = mysql_real_query(conn, sql.c_str(), sql.length());
+
+    // --------------------------------------------------
+    // Finish Now Unless A Result Set Is Pending
+    // --------------------------------------------------
+    if (rc != 0 || mysql_field_count(conn) == 0)
+    {
+        uint64_t affected = (rc == 0) ? mysql_affected_rows(conn) : 0;
+        uint64_t micros = elapsedMicros(start);
+        QueryMetrics::record(site, micros, affected, 0, rc != 0);
+        if (SlowQueryLog::isSlow(micros))
+        {
+            SlowQueryLog::capture(site, sql, vector<string>(), micros);
+        }
+        if (rc != 0)
+        {
+            recover(conn);
+        }
+        return rc;
+    }
+
+    lock_guard<mutex> guard(metricsLock);
+    pending[conn] = Pending{site, sql, start};
+    return rc;
+}
+
+// ============================================================================
+// 11/14 QueryExecutor::store / forget
+// ============================================================================
+MYSQL_RES* QueryExecutor::store(MYSQL* conn)
+{
+    MYSQL_RES* res = mysql_store_result(conn);
+    if (!res)
+    {
+        // The transfer itself can be cut off; restore the session for the next statement
+        recover(conn);
+    }
+
+    Pending p;
+    {
+        lock_guard<mutex> guard(metricsLock);
+        map<MYSQL*, Pending>::iterator it = pending.find(conn);
+
+        // #### Untracked Result Check ####
+        if (it == pending.end())
+        {
+            return res;
+        }
+        p = it->second;
+        pending.erase(it);
+    }
+    uint64_t micros = elapsedMicros(p.start);
+
+    // Row count is kept by the client library; no pass over the rows
+    uint64_t rows = res ? mysql_num_rows(res) : 0;
+    QueryMetrics::record(p.site, micros, rows, res ? QueryMetrics::BYTES_UNKNOWN : 0, res == nullptr);
+    if (SlowQueryLog::isSlow(micros))
+    {
+        SlowQueryLog::capture(p.site, p.sql, vector<string>(), micros);
+    }
+    return res;
+}
+
+void QueryExecutor::forget(MYSQL* conn)
+{
+    Pending p;
+    {
+        lock_guard<mutex> guard(metricsLock);
+        retryable.erase(conn);
+        map<MYSQL*, Pending>::iterator it = pending.find(conn);
+        if (it == pending.end())
+        {
+            return;
+        }
+        p = it->second;
+        pending.erase(it);
+    }
+
+    // The result set was never stored; count the call as failed rather than lose it
+    QueryMetrics::record(p.site, elapsedMicros(p.start), 0, 0, true);
+}
+
+// ============================================================================
+// 12/14 QueryExecutor::read
+// ============================================================================
+int QueryExecutor::read(MYSQL* conn, const string& sql, const char* site)
+{
+    int rc = run(conn, sql, site);
+
+    // #### Lost Connection Retry ####
+    // Safe only because the caller marked the statement idempotent
+    if (rc != 0 && isRetryable(conn))
+    {
+        rc = run(conn, sql, site);
+    }
+    return rc;
+}
+
+// ============================================================================
+// 13/14 QueryExecutor::recover
+// ============================================================================
+bool QueryExecutor::recover(MYSQL* conn)
+{
+    if (!DatabaseConnection::isConnectionLost(conn))
+    {
+        return false;
+    }
+
+    // Only a restored session is worth retrying on; otherwise the error stands
+    bool restored = DatabaseConnection::reconnect(conn);
+    lock_guard<mutex> guard(metricsLock);
+    retryable[conn] = restored;
+    return restored;
+}
+
+// ============================================================================
+// 14/14 QueryExecutor::isRetryable / errorText
+// ============================================================================
+bool QueryExecutor::isRetryable(MYSQL* conn)
+{
+    lock_guard<mutex> guard(metricsLock);
+    map<MYSQL*, bool>::iterator it = retryable.find(conn);
+    return it != retryable.end() && it->second;
+}
+
+string QueryExecutor::errorText(MYSQL* conn)
+{
+    if (isRetryable(conn))
+    {
+        return "Connection to the database was lost and has been restored. The change may not have been saved, please try again.";
+    }
+    string err = mysql_error(conn);
+    return err.empty() ? "Database unavailable." : err;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+// ============================================================================
+// QUERY METRICS HEADER
+// ============================================================================
+#ifndef QUERY_METRICS_H
+#define QUERY_METRICS_H
+
+// External Libraries
+#include <mysql.h>      // MySQL C API
+#include <string>       // Call-site names
+#include <cstdint>      // Fixed-width counters
+
+using namespace std;
+
+// ============================================================================
+// LatencyHistogram
+// HDR-style log-linear histogram of microseconds: exact below 32us, then 16
+// sub-buckets per power of two (about 6% relative error), up to ~12 days.
+// ============================================================================
+class LatencyHistogram
+{
+public:
+    static const int BUCKETS = 640;
+
+    LatencyHistogram();
+    void record(uint64_t micros);
+    uint64_t percentile(double pct) const;
+    uint64_t count() const;
+
+private:
+    uint64_t counts[BUCKETS]; // Samples per bucket
+    uint64_t total;           // Total samples
+
+    static int bucketFor(uint64_t micros);
+    static uint64_t upperBound(int bucket);
+};
+
+// ============================================================================
+// QueryMetrics
+// Process-wide registry of per-call-site query statistics.
+// ============================================================================
+class QueryMetrics
+{
+public:
+    // bytes for a call whose result bytes were not measured (shown as unavailable)
+    static const uint64_t BYTES_UNKNOWN = UINT64_MAX;
+
+    static void record(const string& site, uint64_t micros, uint64_t rows, uint64_t bytes, bool failed);
+    static void addBytes(const string& site, uint64_t bytes);
+    static void printSummary();
+    static bool dumpToFile(const string& filename);
+};
+
+// ============================================================================
+// QueryExecutor
+// Timed drop-ins for mysql_query / mysql_store_result. run() starts the clock
+// for a call site; store() stops it once the result is buffered and records
+// wall time and rows returned. Bytes are left to PreparedQuery and RowStream,
+// which see every cell anyway; a buffered result is not walked twice for them,
+// so its bytes are recorded as unknown and the summary says so.
+// A result run() leaves unstored is closed as a failed call by the next run()
+// on that connection, or when the connection is closed (forget()).
+// A lost connection is re-opened in place. read() is for idempotent
+// statements and is retried once on the restored session; run() never
+// repeats a statement and reports it as retryable through errorText().
+// ============================================================================
+class QueryExecutor
+{
+public:
+    static int run(MYSQL* conn, const string& sql, const char* site);
+    static int read(MYSQL* conn, const string& sql, const char* site);
+    static MYSQL_RES* store(MYSQL* conn);
+    static void forget(MYSQL* conn);
+
+    static bool recover(MYSQL* conn);
+    static bool isRetryable(MYSQL* conn);
+    static string errorText(MYSQL* conn);
+};
+
+#endif
\ No newline at end of file
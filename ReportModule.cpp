@@ -3,6 +3,11 @@
 // ============================================================================
 // Internal Headers
 #include "ReportModule.h"
+#include "QueryMetrics.h"    // Query latency summary
+#include "ResultStream.h"    // Export progress line
+#include "SlowQueryLog.h"    // Slow-query threshold setting
+#include "SalesSnapshot.h"   // In-memory order columns for periodic reports
+#include "ProductCatalog.h"  // Product names for best / worst items
 
 // Standard Libraries
 #include <iostream>    // Standard I/O (cout, cin)
@@ -13,11 +18,12 @@
 #include <ctime>       // Time functions
 #include "Utils.h"     // Shared Utility Functions
 #include <fstream>     // File I/O for CSV Export
+#include <vector>      // Report rows
 
 using namespace std;
 
 // ============================================================================
-// 2/23 printSuccess
+// 2/20 printSuccess
 // ============================================================================
 static void printSuccess(string msg) 
 {
@@ -27,7 +33,7 @@ static void printSuccess(string msg)
 }
 
 // ============================================================================
-// 3/23 printError
+// 3/20 printError
 // ============================================================================
 static void printError(string msg) 
 {
@@ -35,34 +41,42 @@ static void printError(string msg)
 }
 
 // ============================================================================
-// Helper: saveQueryToCSV
+// Helper: loadSales
 // ============================================================================
-static void saveQueryToCSV(MYSQL* conn, string query, string filename) {
+// Periodic sales aggregated from the in-memory snapshot (refreshed by delta
+// first); the store's rollup query covers a snapshot that cannot load
+static bool loadSales(DataStore* store, const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall)
+{
+    shared_ptr<const CatalogSnapshot> catalog = ProductCatalog::get(store->products());
+    if (catalog && SalesSnapshot::refresh(*store) && SalesSnapshot::salesTrend(scope, *catalog, out, overall))
+    {
+        return true;
+    }
+    return store->orders().salesTrend(scope, out, overall);
+}
+
+static bool loadSales(DataStore* store, const PeriodScope& scope, vector<PeriodSales>& out)
+{
+    pair<ItemQty, ItemQty> overall;
+    return loadSales(store, scope, out, overall);
+}
+
+// ============================================================================
+// Helper: saveSalesToCSV
+// ============================================================================
+static void saveSalesToCSV(const vector<PeriodSales>& sales, string filename) {
     ofstream myFile;
     myFile.open(filename + ".csv");
-
-    if (mysql_query(conn, query.c_str())) {
-        cout << " [ERROR] Export failed: " << mysql_error(conn) << endl;
+    if (!myFile) {
+        cout << " [ERROR] Export failed: cannot open " << filename << ".csv" << endl;
         return;
     }
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
-    int num_fields = mysql_num_fields(res);
 
-    MYSQL_FIELD* field;
-    while((field = mysql_fetch_field(res))) {
-        myFile << field->name << ",";
-    }
-    myFile << "\n";
-
-    while ((row = mysql_fetch_row(res))) {
-        for(int i = 0; i < num_fields; i++) {
-            if (row[i]) 
-                myFile << "\"" << row[i] << "\","; 
-            else 
-                myFile << "\"\",";
-        }
-        myFile << "\n";
+    myFile << "Period,Sales (RM),Best Item,Best Qty,Worst Item,Worst Qty\n";
+    for (const PeriodSales& s : sales) {
+        myFile << "\"" << s.period << "\"," << Utils::formatMoney(s.revenue) << ","
+               << "\"" << s.best.name << "\"," << s.best.qty << ","
+               << "\"" << s.worst.name << "\"," << s.worst.qty << "\n";
     }
 
     myFile.close();
@@ -71,15 +85,15 @@ static void saveQueryToCSV(MYSQL* conn, string query, string filename) {
 }
 
 // ============================================================================
-// 4/23 ReportModule (Constructor)
+// 4/20 ReportModule (Constructor)
 // ============================================================================
-ReportModule::ReportModule(MYSQL* c) 
+ReportModule::ReportModule(DataStore* s) 
 { 
-    conn = c; 
+    store = s; 
 }
 
 // ============================================================================
-// 5/23 generateReport (Main Menu)
+// 5/20 generateReport (Main Menu)
 // ============================================================================
 void ReportModule::generateReport()
 {
@@ -101,12 +115,18 @@ void ReportModule::generateReport()
         cout << "   ──────────────────────────────────────────────────────\n";
         cout << "    3) Export Full Data (.csv)\n";
         cout << "    4) View Detailed Product Reports (Tables)\n";
+
+        cout << "\n   [ SYSTEM DIAGNOSTICS ]\n";
+        cout << "   ──────────────────────────────────────────────────────\n";
+        cout << "    5) Query Performance Summary (p50 / p99)\n";
+        cout << "    6) Slow Query Log Threshold (now " << SlowQueryLog::threshold() << " ms)\n";
+        cout << "    7) Rebuild / Verify Sales Rollup\n";
         
         cout << "\n";
         cout << "    0) Back to Main Menu\n";
         cout << "  ────────────────────────────────────────────────────────\n";
         cout << "   Choice ➜ ";
-    choice = Utils::getValidRange(0, 4);
+    choice = Utils::getValidRange(0, 7);
 
         // --------------------------------------------------
         // Navigation Logic
@@ -115,12 +135,21 @@ void ReportModule::generateReport()
         else if (choice == 2) menuOrderAnalysis();
         else if (choice == 3) exportToCSV();
         else if (choice == 4) viewProductReports();
+        else if (choice == 5) { QueryMetrics::printSummary(); system("pause"); }
+        else if (choice == 6)
+        {
+            cout << "   New threshold in ms (0 logs every query) ➜ ";
+            SlowQueryLog::setThreshold((uint64_t)Utils::getValidRange(0, 600000));
+            cout << "   [SUCCESS] Slow queries are written to FAIX_Slow_Queries.log\n";
+            system("pause");
+        }
+        else if (choice == 7) salesRollupMaintenance();
 
     } while (choice != 0);
 }
 
 // ============================================================================
-// 6/23 menuSalesTrends
+// 6/20 menuSalesTrends
 // ============================================================================
 void ReportModule::menuSalesTrends()
 {
@@ -145,7 +174,7 @@ void ReportModule::menuSalesTrends()
 }
 
 // ============================================================================
-// 7/23 menuOrderAnalysis
+// 7/20 menuOrderAnalysis
 // ============================================================================
 void ReportModule::menuOrderAnalysis()
 {
@@ -168,7 +197,7 @@ void ReportModule::menuOrderAnalysis()
 }
 
 // ============================================================================
-// 8/23 viewProductReports
+// 8/20 viewProductReports
 // ============================================================================
 void ReportModule::viewProductReports()
 {
@@ -207,44 +236,31 @@ void ReportModule::viewProductReports()
 }
 
 // ============================================================================
-// 9/23 getItemStats
+// 9/20 itemLabel
 // ============================================================================
-string ReportModule::getItemStats(string dateCondition, bool best)
+static string itemLabel(const ItemQty& item)
 {
-    string sortOrder = best ? "DESC" : "ASC";
-    // --------------------------------------------------
-    // Aggregation Query
-    // --------------------------------------------------
-    string q = "SELECT p.name, SUM(o.quantity) as total_qty "
-               "FROM orders o JOIN products p ON o.product_id = p.id "
-               "WHERE " + dateCondition + " AND o.status = 'Completed' "
-               "GROUP BY p.name ORDER BY total_qty " + sortOrder + " LIMIT 1";
-    
-    if (mysql_query(conn, q.c_str())) return "-";
-    
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row = mysql_fetch_row(res);
-    string result = "-";
-    
-    if (row) result = string(row[0]) + " (" + string(row[1]) + ")";
-    
-    mysql_free_result(res);
-    return result;
+    if (item.name == "-") return "-";
+    return item.name + " (" + to_string(item.qty) + ")";
 }
 
 // ============================================================================
-// 10/23 printReportRow (Table Formatter Helper)
+// 10/20 printSalesRow (Table Formatter Helper)
 // ============================================================================
-void printReportRow(string c1, double sales, string c3, string c4)
+void printSalesRow(string_view label, const PeriodSales& s)
 {
-    cout << "  │ " << left << setw(10) << c1 << " "
-         << "│ RM " << right << setw(9) << sales << " "
-         << "│ " << left << setw(24) << c3 << " "
-         << "│ " << left << setw(24) << c4 << " │\n";
+    string best = itemLabel(s.best);
+    string worst = itemLabel(s.worst);
+    if (best == worst) worst = "-";
+
+    cout << "  │ " << left << setw(10) << label << " "
+         << "│ RM " << right << setw(9) << s.revenue << " "
+         << "│ " << left << setw(24) << best << " "
+         << "│ " << left << setw(24) << worst << " │\n";
 }
 
 // ============================================================================
-// 11/23 reportDaily
+// 11/20 reportDaily
 // ============================================================================
 void ReportModule::reportDaily()
 {
@@ -258,39 +274,24 @@ void ReportModule::reportDaily()
     // --------------------------------------------------
     // Query Daily Sales
     // --------------------------------------------------
-    string dateFilter = "MONTH(order_date) = " + to_string(m) + " AND YEAR(order_date) = " + to_string(y);
-    string q = "SELECT DATE(order_date) as d, SUM(total_price) FROM orders "
-               "WHERE " + dateFilter + " AND status = 'Completed' GROUP BY d ORDER BY d ASC";
-    
-    if (mysql_query(conn, q.c_str())) { printError(mysql_error(conn)); return; }
-    MYSQL_RES* res = mysql_store_result(conn);
+    vector<PeriodSales> sales;
+    if (!loadSales(store, PeriodScope{Period::Day, y, m, false, 0}, sales)) { printError(store->lastError()); system("pause"); return; }
     
     // #### No Data Check ####
-    if (mysql_num_rows(res) == 0) { 
-        printError("No data found for this period."); mysql_free_result(res); system("pause"); return; 
+    if (sales.empty()) { 
+        printError("No data found for this period."); system("pause"); return; 
     }
 
-    MYSQL_ROW row;
     cout << "\n";
     cout << "  ┌────────────┬──────────────┬──────────────────────────┬──────────────────────────┐\n";
     cout << "  │ DATE       │ SALES (RM)   │ BEST ITEM (Qty)          │ WORST ITEM (Qty)         │\n";
     cout << "  ├────────────┼──────────────┼──────────────────────────┼──────────────────────────┤\n";
 
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string dateStr = row[0]; 
-        double sales = stod(row[1]);
-        string dayCond = "DATE(order_date) = '" + dateStr + "'";
-        
-        // Fetch Item Stats for Day
-        string best = getItemStats(dayCond, true);
-        string worst = getItemStats(dayCond, false);
-        if (best == worst) worst = "-";
-
-        printReportRow(dateStr, sales, best, worst);
+        printSalesRow(s.period, s);
     }
     cout << "  └────────────┴──────────────┴──────────────────────────┴──────────────────────────┘\n";
-    mysql_free_result(res);
     
     cout << "\n   [ OPTIONS ]\n";
     cout << "    1) Export this report to Excel (.csv)\n";
@@ -300,12 +301,12 @@ void ReportModule::reportDaily()
     int choice = Utils::getValidRange(0, 1);
 
     if (choice == 1) {
-        saveQueryToCSV(conn, q, "Daily_Sales_Report_" + to_string(y) + "_" + to_string(m)); 
+        saveSalesToCSV(sales, "Daily_Sales_Report_" + to_string(y) + "_" + to_string(m)); 
     }
 }
 
 // ============================================================================
-// 12/23 reportWeekly
+// 12/20 reportWeekly
 // ============================================================================
 void ReportModule::reportWeekly()
 {
@@ -319,39 +320,24 @@ void ReportModule::reportWeekly()
     // --------------------------------------------------
     // Calculate Weeks
     // --------------------------------------------------
-    string dateFilter = "MONTH(order_date) = " + to_string(m) + " AND YEAR(order_date) = " + to_string(y);
-    string q = "SELECT FLOOR((DAY(order_date)-1)/7)+1 as week_num, SUM(total_price) FROM orders "
-               "WHERE " + dateFilter + " AND status = 'Completed' GROUP BY week_num ORDER BY week_num ASC";
-
-    if (mysql_query(conn, q.c_str())) { printError(mysql_error(conn)); return; }
-    MYSQL_RES* res = mysql_store_result(conn);
+    vector<PeriodSales> sales;
+    if (!loadSales(store, PeriodScope{Period::Week, y, m, false, 0}, sales)) { printError(store->lastError()); system("pause"); return; }
     
     // #### No Data Check ####
-    if (mysql_num_rows(res) == 0) { 
-        printError("No data found."); mysql_free_result(res); system("pause"); return; 
+    if (sales.empty()) { 
+        printError("No data found."); system("pause"); return; 
     }
 
-    MYSQL_ROW row;
     cout << "\n";
     cout << "  ┌────────────┬──────────────┬──────────────────────────┬──────────────────────────┐\n";
     cout << "  │ PERIOD     │ SALES (RM)   │ BEST ITEM (Qty)          │ WORST ITEM (Qty)         │\n";
     cout << "  ├────────────┼──────────────┼──────────────────────────┼──────────────────────────┤\n";
 
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string weekNum = row[0];
-        double sales = stod(row[1]);
-        string weekCond = "FLOOR((DAY(order_date)-1)/7)+1 = " + weekNum + " AND " + dateFilter;
-        
-        // Fetch Item Stats for Week
-        string best = getItemStats(weekCond, true);
-        string worst = getItemStats(weekCond, false);
-        if (best == worst) worst = "-";
-
-        printReportRow("Week " + weekNum, sales, best, worst);
+        printSalesRow("Week " + s.period, s);
     }
     cout << "  └────────────┴──────────────┴──────────────────────────┴──────────────────────────┘\n";
-    mysql_free_result(res);
     
     cout << "\n   [ OPTIONS ]\n";
     cout << "    1) Export this report to Excel (.csv)\n";
@@ -361,12 +347,12 @@ void ReportModule::reportWeekly()
     int choice = Utils::getValidRange(0, 1);
 
     if (choice == 1) {
-        saveQueryToCSV(conn, q, "Weekly_Sales_Report_" + to_string(y) + "_" + to_string(m)); 
+        saveSalesToCSV(sales, "Weekly_Sales_Report_" + to_string(y) + "_" + to_string(m)); 
     }
 }
 
 // ============================================================================
-// 13/23 reportMonthly
+// 13/20 reportMonthly
 // ============================================================================
 void ReportModule::reportMonthly()
 {
@@ -376,40 +362,28 @@ void ReportModule::reportMonthly()
 
     cout << "\n   \033[1;33m[ REPORT: MONTHLY SALES FOR " << y << " ]\033[0m\n";
     
-    string q = "SELECT MONTH(order_date) as m, SUM(total_price) FROM orders "
-               "WHERE YEAR(order_date) = " + to_string(y) + " AND status = 'Completed' GROUP BY m ORDER BY m ASC";
-
-    mysql_query(conn, q.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
+    vector<PeriodSales> sales;
+    if (!loadSales(store, PeriodScope{Period::Month, y, 0, false, 0}, sales)) { printError(store->lastError()); system("pause"); return; }
     
     cout << "\n";
     cout << "  ┌────────────┬──────────────┬──────────────────────────┬──────────────────────────┐\n";
     cout << "  │ MONTH      │ SALES (RM)   │ BEST ITEM (Qty)          │ WORST ITEM (Qty)         │\n";
     cout << "  ├────────────┼──────────────┼──────────────────────────┼──────────────────────────┤\n";
 
-    if (mysql_num_rows(res) == 0) { 
+    if (sales.empty()) { 
         cout << "  │ " << left << setw(86) << "No Sales Recorded for this Year" << " │\n"; 
     }
 
-    MYSQL_ROW row;
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string monthNum = row[0];
-        double sales = stod(row[1]);
-        string monthNames[] = {"", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-        string mName = monthNames[stoi(monthNum)];
-
-        string monthCond = "MONTH(order_date) = " + monthNum + " AND YEAR(order_date) = " + to_string(y);
-        
-        // Fetch Item Stats for Month
-        string best = getItemStats(monthCond, true);
-        string worst = getItemStats(monthCond, false);
-        if (best == worst) worst = "-";
+        // Period key is YYYY-MM
+        int monthNum = (s.period.size() >= 7) ? atoi(s.period.c_str() + 5) : 0;
+        static const char* monthNames[] = {"", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        string_view mName = (monthNum >= 1 && monthNum <= 12) ? monthNames[monthNum] : "-";
 
-        printReportRow(mName, sales, best, worst);
+        printSalesRow(mName, s);
     }
     cout << "  └────────────┴──────────────┴──────────────────────────┴──────────────────────────┘\n";
-    mysql_free_result(res);
     
     cout << "\n   [ OPTIONS ]\n";
     cout << "    1) Export this report to Excel (.csv)\n";
@@ -419,41 +393,30 @@ void ReportModule::reportMonthly()
     int choice = Utils::getValidRange(0, 1);
 
     if (choice == 1) {
-        saveQueryToCSV(conn, q, "Monthly_Sales_Report_" + to_string(y)); 
+        saveSalesToCSV(sales, "Monthly_Sales_Report_" + to_string(y)); 
     }
 }
 
 // ============================================================================
-// 14/23 reportYearly
+// 14/20 reportYearly
 // ============================================================================
 void ReportModule::reportYearly()
 {
     cout << "\n   \033[1;33m[ REPORT: YEARLY SUMMARY ]\033[0m\n";
 
-    string q = "SELECT YEAR(order_date) as y, SUM(total_price) FROM orders WHERE status = 'Completed' GROUP BY y ORDER BY y DESC";
-    mysql_query(conn, q.c_str());
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
+    vector<PeriodSales> sales;
+    if (!loadSales(store, PeriodScope{Period::Year, 0, 0, true, 0}, sales)) { printError(store->lastError()); system("pause"); return; }
 
     cout << "\n";
     cout << "  ┌────────────┬──────────────┬──────────────────────────┬──────────────────────────┐\n";
     cout << "  │ YEAR       │ SALES (RM)   │ BEST ITEM (Qty)          │ WORST ITEM (Qty)         │\n";
     cout << "  ├────────────┼──────────────┼──────────────────────────┼──────────────────────────┤\n";
 
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string yearStr = row[0];
-        double sales = stod(row[1]);
-        string yearCond = "YEAR(order_date) = " + yearStr;
-        
-        string best = getItemStats(yearCond, true);
-        string worst = getItemStats(yearCond, false);
-        if (best == worst) worst = "-";
-
-        printReportRow(yearStr, sales, best, worst);
+        printSalesRow(s.period, s);
     }
     cout << "  └────────────┴──────────────┴──────────────────────────┴──────────────────────────┘\n";
-    mysql_free_result(res);
     
     cout << "\n   [ OPTIONS ]\n";
     cout << "    1) Export this report to Excel (.csv)\n";
@@ -463,26 +426,22 @@ void ReportModule::reportYearly()
     int choice = Utils::getValidRange(0, 1);
 
     if (choice == 1) {
-        saveQueryToCSV(conn, q, "Yearly_Sales_Report"); 
+        saveSalesToCSV(sales, "Yearly_Sales_Report"); 
     }
 }
 
 // ============================================================================
-// 15/23 reportViewAll
+// 15/20 reportViewAll
 // ============================================================================
 void ReportModule::reportViewAll()
 {
     cout << "\n   \033[1;33m[ REPORT: ALL-TIME DAILY LEDGER ]\033[0m\n";
 
-    string q = "SELECT DATE(order_date) as d, SUM(total_price) FROM orders "
-               "WHERE status = 'Completed' GROUP BY d ORDER BY d DESC";
-    
-    if (mysql_query(conn, q.c_str())) { printError(mysql_error(conn)); return; }
-    MYSQL_RES* res = mysql_store_result(conn);
-    MYSQL_ROW row;
+    vector<PeriodSales> sales;
+    if (!loadSales(store, PeriodScope{Period::Day, 0, 0, true, 0}, sales)) { printError(store->lastError()); system("pause"); return; }
 
-    if (mysql_num_rows(res) == 0) { 
-        printError("No data found."); mysql_free_result(res); system("pause"); return; 
+    if (sales.empty()) { 
+        printError("No data found."); system("pause"); return; 
     }
 
     cout << "\n";
@@ -490,81 +449,67 @@ void ReportModule::reportViewAll()
     cout << "  │ DATE       │ SALES (RM)   │ BEST ITEM (Qty)          │ WORST ITEM (Qty)         │\n";
     cout << "  ├────────────┼──────────────┼──────────────────────────┼──────────────────────────┤\n";
 
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string dateStr = row[0];
-        double sales = stod(row[1]);
-        string dateFilter = "DATE(order_date) = '" + dateStr + "'";
-        
-        string best = getItemStats(dateFilter, true);
-        string worst = getItemStats(dateFilter, false);
-        if (best == worst) worst = "-";
-
-        printReportRow(dateStr, sales, best, worst);
+        printSalesRow(s.period, s);
     }
     cout << "  └────────────┴──────────────┴──────────────────────────┴──────────────────────────┘\n";
-    mysql_free_result(res);
     system("pause");
 }
 
 // ============================================================================
-// 16/23 showTrend
+// 16/20 showTrend
 // ============================================================================
 void ReportModule::showTrend(string type)
 {
     system("cls");
-    string dateFormat, limit, header;
-    if (type == "YEAR")       { header = "YEARLY PERFORMANCE (Trend)"; dateFormat = "%Y"; limit = "5"; } 
-    else if (type == "MONTH") { header = "MONTHLY PERFORMANCE (Trend)"; dateFormat = "%Y-%m"; limit = "12"; } 
-    else                      { header = "DAILY PERFORMANCE (Trend)"; dateFormat = "%Y-%m-%d"; limit = "30"; }
+    string header;
+    PeriodScope scope{Period::Day, 0, 0, true, 30};
+    if (type == "YEAR")       { header = "YEARLY PERFORMANCE (Trend)"; scope.unit = Period::Year; scope.limit = 5; } 
+    else if (type == "MONTH") { header = "MONTHLY PERFORMANCE (Trend)"; scope.unit = Period::Month; scope.limit = 12; } 
+    else                      { header = "DAILY PERFORMANCE (Trend)"; }
 
     cout << "\n  ==================================================================================================\n";
     cout << "    " << header << "\n";
     cout << "  ==================================================================================================\n";
 
-    string query = "SELECT DATE_FORMAT(order_date, '" + dateFormat + "') as Period, SUM(total_price) as Rev FROM orders WHERE status = 'Completed' GROUP BY Period ORDER BY Period DESC LIMIT " + limit;
-    mysql_query(conn, query.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row;
+    // Periods on screen and the all-time insight come from one pass over the snapshot
+    vector<PeriodSales> sales;
+    pair<ItemQty, ItemQty> global(ItemQty{"-", 0}, ItemQty{"-", 0});
+    if (!loadSales(store, scope, sales, global)) { printError(store->lastError()); system("pause"); return; }
 
     // --------------------------------------------------
     // Determine Scale Max Result
     // --------------------------------------------------
     double maxRev = 1.0; 
-    while ((row = mysql_fetch_row(res))) {
-        double r = stod(row[1]); 
-        if (r > maxRev) maxRev = r; 
+    for (const PeriodSales& s : sales) {
+        if (s.revenue > maxRev) maxRev = s.revenue; 
     }
-    mysql_data_seek(res, 0); 
 
     // Header Graph Width = 29 dashes.
     cout << "  ┌────────────┬─────────────────────────────┬──────────────┬──────────────────────┬──────────────────────┐\n";
     cout << "  │ PERIOD     │ REVENUE GRAPH               │ REVENUE      │ BEST ITEM            │ WORST ITEM           │\n";
     cout << "  ├────────────┼─────────────────────────────┼──────────────┼──────────────────────┼──────────────────────┤\n";
 
-    while ((row = mysql_fetch_row(res)))
+    for (const PeriodSales& s : sales)
     {
-        string period = row[0];
-        double rev = stod(row[1]);
-
-        string condition = "DATE_FORMAT(o.order_date, '" + dateFormat + "') = '" + period + "'";
-        string bestItem = getTopProduct(condition); 
-        string worstItem = getLowProduct(condition);
+        string bestItem = s.best.name; 
+        string worstItem = s.worst.name;
         if (bestItem == worstItem) worstItem = "-";
         
         // Truncate strings to prevent table misalignment
         if (bestItem.length() > 20) bestItem = bestItem.substr(0, 17) + "...";
         if (worstItem.length() > 20) worstItem = worstItem.substr(0, 17) + "...";
 
-        cout << "  │ " << left << setw(10) << period << " ";
+        cout << "  │ " << left << setw(10) << s.period << " ";
         
         // GRAPH COLUMN (Width 29 in Header)
         // We print "  " + blockbar + "  " to align. Blockbar is variable length but max 25 chars.
         cout << "│  "; 
-        printBlockGraph(rev, maxRev); // Prints appropriate number of blocks
+        printBlockGraph(s.revenue, maxRev); // Prints appropriate number of blocks
         cout << "  ";
 
-        cout << "│ RM " << right << setw(9) << rev << " "
+        cout << "│ RM " << right << setw(9) << s.revenue << " "
              << "│ " << left << setw(20) << bestItem << " "
              << "│ " << left << setw(20) << worstItem << " │\n";
     }
@@ -573,8 +518,8 @@ void ReportModule::showTrend(string type)
     // --------------------------------------------------
     // Global Stats Footer
     // --------------------------------------------------
-    string globalBest = getGlobalBestItem(); 
-    string globalWorst = getGlobalWorstItem();
+    string globalBest = global.first.name; 
+    string globalWorst = global.second.name;
     if (globalBest == globalWorst) globalWorst = "-";
     
     cout << "   [INSIGHT] Best Selling: " << globalBest << "\n";
@@ -584,12 +529,11 @@ void ReportModule::showTrend(string type)
 }
 
 // ============================================================================
-// 17/23 showHighLowOrders
+// 17/20 showHighLowOrders
 // ============================================================================
 void ReportModule::showHighLowOrders(bool high)
 {
     system("cls");
-    string order = high ? "DESC" : "ASC"; 
     string title = high ? "TOP 5 HIGH VALUE ORDERS" : "TOP 5 LOW VALUE ORDERS";
     
     cout << "\n  =======================================================\n"; 
@@ -599,30 +543,36 @@ void ReportModule::showHighLowOrders(bool high)
     // --------------------------------------------------
     // Query Top/Bottom 5
     // --------------------------------------------------
-    string query = "SELECT smart_id, customer_name, total_price, status, order_date FROM orders WHERE status = 'Completed' ORDER BY total_price " + order + " LIMIT 5";
-    mysql_query(conn, query.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row;
+    vector<Order> orders;
+    if (!store->orders().extremeOrders(high, 5, orders)) { printError(store->lastError()); system("pause"); return; }
+
+    // Range over every completed order, from the snapshot (left out when it cannot load)
+    CompletedSummary summary;
+    if (SalesSnapshot::refresh(*store) && SalesSnapshot::completedSummary(summary) && summary.orders > 0)
+    {
+        cout << "    " << summary.orders << " completed orders, RM " << Utils::formatMoney(summary.revenue)
+             << " | Lowest RM " << Utils::formatMoney(summary.lowest)
+             << " | Highest RM " << Utils::formatMoney(summary.highest) << "\n\n";
+    }
 
     cout << "  ┌────┬────────────────────┬─────────────────┬──────────────┬─────────────────────┐\n";
     cout << "  │  # │ ORDER ID           │ CUSTOMER        │ VALUE        │ DATE                │\n";
     cout << "  ├────┼────────────────────┼─────────────────┼──────────────┼─────────────────────┤\n";
     
     int i = 1;
-    while ((row = mysql_fetch_row(res))) {
+    for (const Order& o : orders) {
         cout << "  │ " << right << setw(2) << i++ << " "
-             << "│ " << left << setw(18) << row[0] << " "
-             << "│ " << left << setw(15) << row[1] << " "
-             << "│ RM " << right << setw(9) << row[2] << " "
-             << "│ " << left << setw(19) << row[4] << " │\n";
+             << "│ " << left << setw(18) << o.smartId << " "
+             << "│ " << left << setw(15) << o.customerName << " "
+             << "│ RM " << right << setw(9) << Utils::formatMoney(o.totalPrice) << " "
+             << "│ " << left << setw(19) << o.orderDate << " │\n";
     }
     cout << "  └────┴────────────────────┴─────────────────┴──────────────┴─────────────────────┘\n";
-    mysql_free_result(res); 
     system("pause");
 }
 
 // ============================================================================
-// 18/23 printBlockGraph
+// 18/20 printBlockGraph
 // ============================================================================
 void ReportModule::printBlockGraph(double value, double maxVal) 
 {
@@ -638,63 +588,7 @@ void ReportModule::printBlockGraph(double value, double maxVal)
 }
 
 // ============================================================================
-// 19/23 getTopProduct
-// ============================================================================
-string ReportModule::getTopProduct(string dateCondition) {
-    string q = "SELECT p.name FROM orders o JOIN products p ON o.product_id = p.id WHERE " + dateCondition + " AND o.status = 'Completed' GROUP BY p.name ORDER BY SUM(o.quantity) DESC LIMIT 1";
-    mysql_query(conn, q.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row = mysql_fetch_row(res);
-    string name = "-"; 
-    if (row) name = row[0]; 
-    mysql_free_result(res); 
-    return name;
-}
-
-// ============================================================================
-// 20/23 getLowProduct
-// ============================================================================
-string ReportModule::getLowProduct(string dateCondition) {
-    string q = "SELECT p.name FROM orders o JOIN products p ON o.product_id = p.id WHERE " + dateCondition + " AND o.status = 'Completed' GROUP BY p.name ORDER BY SUM(o.quantity) ASC LIMIT 1";
-    mysql_query(conn, q.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row = mysql_fetch_row(res);
-    string name = "-"; 
-    if (row) name = row[0]; 
-    mysql_free_result(res); 
-    return name;
-}
-
-// ============================================================================
-// 21/23 getGlobalBestItem
-// ============================================================================
-string ReportModule::getGlobalBestItem() {
-    string q = "SELECT p.name FROM orders o JOIN products p ON o.product_id = p.id WHERE o.status = 'Completed' GROUP BY p.name ORDER BY SUM(o.quantity) DESC LIMIT 1";
-    mysql_query(conn, q.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row = mysql_fetch_row(res);
-    string name = "-"; 
-    if(row) name = row[0]; 
-    mysql_free_result(res); 
-    return name;
-}
-
-// ============================================================================
-// 22/23 getGlobalWorstItem
-// ============================================================================
-string ReportModule::getGlobalWorstItem() {
-    string q = "SELECT p.name FROM orders o JOIN products p ON o.product_id = p.id WHERE o.status = 'Completed' GROUP BY p.name ORDER BY SUM(o.quantity) ASC LIMIT 1";
-    mysql_query(conn, q.c_str()); 
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row = mysql_fetch_row(res);
-    string name = "-"; 
-    if(row) name = row[0]; 
-    mysql_free_result(res); 
-    return name;
-}
-
-// ============================================================================
-// 23/23 exportToCSV
+// 19/20 exportToCSV
 // ============================================================================
 void ReportModule::exportToCSV() {
     cout << "\n   ┌────────────────────────────────────────────────────┐\n";
@@ -709,27 +603,71 @@ void ReportModule::exportToCSV() {
     // --------------------------------------------------
     myFile << "Date,Order ID,Customer,Product,Qty,Total (RM),Status\n";
 
-    string query = "SELECT o.order_date, o.smart_id, o.customer_name, p.name, o.quantity, o.total_price, o.status FROM orders o JOIN products p ON o.product_id = p.id ORDER BY o.order_date DESC";
-    
-    if (mysql_query(conn, query.c_str())) 
-    { 
-        cout << "   \033[1;31m[ERROR] Database Error.\033[0m\n"; 
-        return; 
-    }
-    
-    MYSQL_RES* res = mysql_store_result(conn); 
-    MYSQL_ROW row;
-    
     // --------------------------------------------------
-    // Write Rows
+    // Write Rows (Visited One Order At A Time)
     // --------------------------------------------------
-    while ((row = mysql_fetch_row(res))) 
+    StreamProgress progress("Exporting");
+    unsigned long long written = 0;
+    bool ok = store->orders().forEachOrder([&](const Order& o)
     {
-        myFile << row[0] << "," << row[1] << ",\"" << row[2] << "\"," << row[3] << "," << row[4] << "," << row[5] << "," << row[6] << "\n";
-    }
+        myFile << o.orderDate << "," << o.smartId << ",\"" << o.customerName << "\","
+               << o.productName << "," << o.quantity << "," << Utils::formatMoney(o.totalPrice) << ","
+               << o.status << "\n";
+        progress.tick(++written);
+    });
+    progress.finish(written);
     
-    mysql_free_result(res); 
     myFile.close();
+
+    // #### Mid-Export Failure Check ####
+    if (!ok)
+    {
+        cout << "   \033[1;31m[ERROR] Export interrupted: " << store->lastError() << "\033[0m\n";
+        system("pause");
+        return;
+    }
     printSuccess("Export completed successfully\n    \033[1;32m✔ File saved as: FAIX_Sales_Report.csv"); 
     system("pause");
+}
+
+// ============================================================================
+// 20/20 salesRollupMaintenance
+// ============================================================================
+void ReportModule::salesRollupMaintenance()
+{
+    system("cls");
+    cout << "\n  =======================================================\n";
+    cout << "    DAILY SALES ROLLUP\n";
+    cout << "  =======================================================\n";
+    cout << "   Every report reads the per-day product totals, which\n";
+    cout << "   order writes keep in step with the orders table.\n\n";
+    cout << "   1) Verify against the orders table\n";
+    cout << "   2) Rebuild from the orders table (backfill)\n";
+    cout << "   0) Cancel\n";
+    cout << "   Choice ➜ ";
+    int choice = Utils::getValidRange(0, 2);
+
+    if (choice == 1)
+    {
+        long long mismatches = 0;
+        if (!store->orders().verifySalesRollup(mismatches)) { printError(store->lastError()); system("pause"); return; }
+
+        // #### Drift Check ####
+        if (mismatches == 0)
+        {
+            printSuccess("Rollup matches the orders table");
+        }
+        else
+        {
+            printError(to_string(mismatches) + " rollup row(s) differ from the orders table. Rebuild to repair.");
+        }
+        system("pause");
+    }
+    else if (choice == 2)
+    {
+        long long rows = 0;
+        if (!store->orders().rebuildSalesRollup(rows)) { printError(store->lastError()); system("pause"); return; }
+        printSuccess("Rollup rebuilt: " + to_string(rows) + " day / product / status rows");
+        system("pause");
+    }
 }
\ No newline at end of file
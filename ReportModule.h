@@ -4,8 +4,10 @@
 #ifndef REPORT_MODULE_H
 #define REPORT_MODULE_H
 
+// Internal Headers
+#include "Repository.h" // Storage-engine neutral data access
+
 // External Libraries
-#include <mysql.h>      // MySQL C API
 #include <string>       // String manipulation
 #include <iostream>     // I/O operations
 
@@ -17,7 +19,7 @@ public:
     // ============================================================================
     // Constructor
     // ============================================================================
-    ReportModule(MYSQL* c);
+    ReportModule(DataStore* s);
     
     // ============================================================================
     // Public Operations
@@ -25,7 +27,7 @@ public:
     void generateReport();
 
 private:
-    MYSQL* conn; // Database Connection Handler
+    DataStore* store; // Sales reports come from store->orders()
 
     // ============================================================================
     // Reporting Menus (Periodic)
@@ -55,14 +57,10 @@ private:
     void exportToCSV();
 
     // ============================================================================
-    // Data Stats Helpers
+    // Maintenance
     // ============================================================================
-    string getItemStats(string dateCondition, bool best);
-    string getGlobalBestItem();
-    string getGlobalWorstItem();
-    string getTopProduct(string dateCondition);
-    string getLowProduct(string dateCondition);
-    
+    void salesRollupMaintenance();
+
     // ============================================================================
     // Graph Helpers
     // ============================================================================
@@ -0,0 +1,309 @@
+// ============================================================================
+// REPOSITORY HEADER
+// ============================================================================
+#ifndef REPOSITORY_H
+#define REPOSITORY_H
+
+// Standard Libraries
+#include <string>       // Text columns
+#include <vector>       // Result lists
+#include <functional>   // Streaming visitors
+#include <utility>      // Best / worst pairs
+#include <map>          // Per-product quantities
+
+using namespace std;
+
+// ============================================================================
+// Domain Records
+// One struct per table. Dates are text in MySQL DATETIME form
+// ("YYYY-MM-DD HH:MM:SS") so both storage engines compare them the same way.
+// ============================================================================
+struct Product
+{
+    int id;
+    string name;
+    string type;             // "Ready Stock" or "Custom"
+    double price;
+    int stock;
+    int productionHours;
+};
+
+struct Order
+{
+    long long id;
+    string smartId;          // e.g. CAS-15022025-001
+    int productId;
+    string productName;      // Joined from products on reads
+    string customerName;
+    string address;
+    int quantity;
+    double totalPrice;
+    string orderDate;        // Empty on insert = now
+    string expectedDate;
+    string status;
+    string custSize;
+    string custColor;
+    string custText;
+};
+
+struct Issue
+{
+    long long id;
+    long long orderId;
+    string smartId;          // Joined from orders on reads
+    string issueType;
+    string resolution;
+    string logDate;
+};
+
+struct Admin
+{
+    int id;
+    string username;
+    string password;
+    string role;             // "Manager" or "Staff"
+};
+
+// ============================================================================
+// Report Records
+// Sales are always over Completed orders. Period keys are "YYYY-MM-DD",
+// the week of the month ("1".."5"), "YYYY-MM" or "YYYY".
+// ============================================================================
+enum class Period { Day, Week, Month, Year };
+
+struct PeriodScope
+{
+    Period unit;
+    int year;                // 0 = every year
+    int month;               // 0 = every month
+    bool newestFirst;
+    int limit;               // 0 = no limit
+};
+
+struct ItemQty
+{
+    string name;             // "-" when nothing sold
+    long long qty;
+};
+
+struct PeriodSales
+{
+    string period;
+    double revenue;
+    ItemQty best;
+    ItemQty worst;
+};
+
+// One order reduced to what the report snapshot aggregates
+struct OrderFact
+{
+    long long id;
+    int day;                 // Format::dayNumber of the order date
+    int productId;
+    int quantity;
+    long long cents;         // total_price in cents
+    string status;
+    bool removed;            // Deleted since the feed version (other fields unset)
+};
+
+struct RedoTimeline
+{
+    string start;            // Dates as YYYY-MM-DD
+    string productionEta;
+    string deliveryEta;
+};
+
+// ============================================================================
+// Browse Records
+// The order browser pages newest first on (order_date, id). Each page seeks
+// past the key of a row already on screen instead of skipping with OFFSET.
+// ============================================================================
+struct OrderFilter
+{
+    string status;           // Empty = any status
+    string fromDate;         // YYYY-MM-DD, empty = open
+    string toDate;           // YYYY-MM-DD inclusive, empty = open
+};
+
+struct OrderSeek
+{
+    string orderDate;        // Key of the boundary row; empty = newest page
+    long long id;
+    bool older;              // Rows past the key (next page) or before it (previous page)
+};
+
+// Orders picked for a bulk status change: an explicit smart_id list, or else
+// every order matching the filter (and product, when set)
+struct OrderSelection
+{
+    OrderFilter filter;
+    int productId;           // 0 = any product
+    vector<string> smartIds; // Non-empty = exactly these orders; filter ignored
+};
+
+// Result of a single-row lookup: a missing row is not a storage failure
+enum class Lookup { Found, Missing, Failed };
+
+// Result of placing an order: running out of stock is not a storage failure
+enum class PlaceResult { Placed, OutOfStock, Failed };
+
+// ============================================================================
+// ProductRepository
+// ============================================================================
+class ProductRepository
+{
+public:
+    virtual ~ProductRepository() {}
+
+    virtual bool listAll(vector<Product>& out) = 0;
+    virtual Lookup find(int id, Product& out) = 0;
+    virtual bool searchByName(const string& keyword, vector<Product>& out) = 0;
+    virtual bool add(Product& p) = 0;
+    virtual bool update(const Product& p) = 0;
+    virtual bool remove(int id) = 0;
+    virtual bool adjustStock(int id, int delta) = 0;
+};
+
+// ============================================================================
+// Order Write Limits
+// At most this many orders are written by one transaction (an import chunk,
+// a bulk status chunk), which keeps write transactions short; the MySQL
+// change feed's replay window relies on that.
+// Change feed readers not seen for CHANGE_READER_TTL_HOURS stop holding back
+// pruning, and load in full when they return.
+// ============================================================================
+static const int MAX_ORDERS_PER_TRANSACTION = 5000;
+static const int CHANGE_READER_TTL_HOURS = 24;
+
+// ============================================================================
+// OrderRepository
+// Reads return orders joined with their product name, in id order.
+// ============================================================================
+class OrderRepository
+{
+public:
+    virtual ~OrderRepository() {}
+
+    // #### Orders ####
+    virtual bool listAll(vector<Order>& out) = 0;
+    virtual Lookup findBySmartId(const string& smartId, Order& out) = 0;
+    // Hands out count consecutive numbers of today's sequence, first being the lowest; never twice.
+    // day (Format::dayNumber) is the date of the counter they came from, which the smart_id must carry.
+    virtual bool reserveDailySequences(int count, int& first, int& day) = 0;
+    virtual bool countByProduct(int productId, int& out) = 0;
+    // Every order currently in one of the statuses, oldest first
+    virtual bool listByStatus(const vector<string>& statuses, vector<Order>& out) = 0;
+    // Orders with an id above afterId, in id order (rows added since a previous read)
+    virtual bool listAfterId(long long afterId, vector<Order>& out) = 0;
+    virtual bool insert(Order& o) = 0;
+    virtual bool updateStatus(const string& smartId, const string& status) = 0;
+    virtual bool remove(const string& smartId) = 0;
+
+    // Inserts the order and, when deductStock is set, takes its quantity off
+    // the product in the same transaction. Nothing is written on OutOfStock.
+    virtual PlaceResult place(Order& o, bool deductStock) = 0;
+
+    // Bulk form of place: multi-row inserts plus one decrement per product
+    // (product id -> units) in a single transaction. Order ids are not filled in.
+    // At most MAX_ORDERS_PER_TRANSACTION orders per call.
+    virtual PlaceResult placeBulk(const vector<Order>& orders, const map<int, int>& stockTaken) = 0;
+
+    // One page of at most limit orders, newest first, whichever way it seeks
+    virtual bool browse(const OrderFilter& filter, const OrderSeek& seek, int limit, vector<Order>& out) = 0;
+
+    // #### Bulk Status Changes ####
+    virtual bool countByStatus(const OrderSelection& sel, map<string, int>& out) = 0;
+
+    // Sets status 'to' on the selected orders currently in one of 'from', committing
+    // every chunkSize rows (capped at MAX_ORDERS_PER_TRANSACTION). 'to' must not be
+    // in 'from'. updated is the total changed.
+    virtual bool bulkUpdateStatus(const OrderSelection& sel, const vector<string>& from, const string& to,
+                                  int chunkSize, long long& updated) = 0;
+
+    // #### Sales Reports ####
+    virtual bool salesByPeriod(const PeriodScope& scope, vector<PeriodSales>& out) = 0;
+    // salesByPeriod plus the best / worst items over every period in scope
+    // (including those past the limit), reduced from the same single pass
+    virtual bool salesTrend(const PeriodScope& scope, vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall) = 0;
+    virtual bool extremeOrders(bool highest, int limit, vector<Order>& out) = 0;
+
+    // #### Daily Sales Rollup ####
+    // Orders summed per (day, product, status). Order writes keep it current;
+    // these recompute it from the orders table (backfill) or count the rollup
+    // rows that disagree with it (0 = in step).
+    virtual bool rebuildSalesRollup(long long& rows) = 0;
+    virtual bool verifySalesRollup(long long& mismatches) = 0;
+
+    // #### Change Feed ####
+    // Visits, in id order, the current facts of every order inserted, changed or
+    // deleted after version, then moves version to the newest change read.
+    // Version 0 visits every order. Orders may be visited again in later calls.
+    // reader names the caller (one name per watermark it keeps); its progress is
+    // recorded so pruneChanges keeps what it still needs. When the changes it
+    // needed were pruned while it was away, version comes back 0: the reader must
+    // drop what it holds (and anything just visited) and load again from 0.
+    virtual bool forEachChange(const string& reader, long long& version, const function<void(const OrderFact&)>& visit) = 0;
+    // Newest version in the feed (0 = none yet), for a reader that loaded the orders
+    // some other way; the reader is recorded as starting there
+    virtual bool latestChangeVersion(const string& reader, long long& version) = 0;
+    // Deletes the changes every active reader has read past; removed is how many
+    virtual bool pruneChanges(long long& removed) = 0;
+
+    // Visits every order newest first without holding the whole table in memory
+    virtual bool forEachOrder(const function<void(const Order&)>& visit) = 0;
+};
+
+// ============================================================================
+// IssueRepository
+// Refund and redo change the order and log the issue together.
+// ============================================================================
+class IssueRepository
+{
+public:
+    virtual ~IssueRepository() {}
+
+    virtual bool listAll(vector<Issue>& out) = 0;
+    virtual bool search(const string& keyword, vector<Issue>& out) = 0;
+    virtual Lookup find(long long id, Issue& out) = 0;
+    virtual bool updateResolution(long long id, const string& resolution) = 0;
+    virtual bool remove(long long id) = 0;
+    virtual bool refund(long long orderId, const string& reason) = 0;
+    virtual bool scheduleRedo(long long orderId, const string& reason, RedoTimeline& out) = 0;
+};
+
+// ============================================================================
+// AdminRepository
+// ============================================================================
+class AdminRepository
+{
+public:
+    virtual ~AdminRepository() {}
+
+    virtual Lookup authenticate(const string& username, const string& password, string& role) = 0;
+    virtual Lookup findByUsername(const string& username, Admin& out) = 0;
+    virtual Lookup find(int id, Admin& out) = 0;
+    virtual bool listAll(vector<Admin>& out) = 0;
+    virtual bool add(Admin& a) = 0;
+    virtual bool remove(int id) = 0;
+    virtual bool count(int& out) = 0;
+};
+
+// ============================================================================
+// DataStore
+// The four repositories of one storage engine. Modules only see this
+// interface; main picks MySqlStore or MemoryStore. lastError() describes the
+// most recent failed call on any of the repositories.
+// ============================================================================
+class DataStore
+{
+public:
+    virtual ~DataStore() {}
+
+    virtual ProductRepository& products() = 0;
+    virtual OrderRepository& orders() = 0;
+    virtual IssueRepository& issues() = 0;
+    virtual AdminRepository& admins() = 0;
+    virtual string lastError() = 0;
+};
+
+#endif
\ No newline at end of file
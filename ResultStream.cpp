@@ -0,0 +1,201 @@
+// ============================================================================
+// RESULT STREAM IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "ResultStream.h"
+#include "QueryMetrics.h"    // Per-call-site latency recording
+#include "SlowQueryLog.h"    // Slow statement capture
+
+// Standard Libraries
+#include <iostream>    // Progress output (cout)
+
+using namespace std;
+
+// ============================================================================
+// 1/8 iterator
+// ============================================================================
+RowStream::iterator::iterator(RowStream* s, MYSQL_ROW r)
+{
+    stream = s;
+    row = r;
+}
+
+MYSQL_ROW RowStream::iterator::operator*() const
+{
+    return row;
+}
+
+RowStream::iterator& RowStream::iterator::operator++()
+{
+    row = stream->next();
+    return *this;
+}
+
+bool RowStream::iterator::operator!=(const iterator& other) const
+{
+    return row != other.row;
+}
+
+// ============================================================================
+// 2/8 RowStream (Constructor)
+// ============================================================================
+RowStream::RowStream(MYSQL* c, const string& query, const char* callSite)
+{
+    conn = c;
+    res = nullptr;
+    rows = 0;
+    bytes = 0;
+    site = callSite;
+    start = chrono::steady_clock::now();
+
+    // --------------------------------------------------
+    // Start Unbuffered Read
+    // --------------------------------------------------
+    bool sent = !mysql_real_query(conn, query.c_str(), query.length());
+
+    // #### Lost Connection Check ####
+    // Nothing has been read yet, so a read-only stream can simply start over
+    if (!sent && QueryExecutor::recover(conn))
+    {
+        start = chrono::steady_clock::now();
+        sent = !mysql_real_query(conn, query.c_str(), query.length());
+    }
+    if (sent)
+    {
+        res = mysql_use_result(conn);
+    }
+
+    // Exports are long by design, so only time-to-first-row counts as slow
+    uint64_t micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    if (SlowQueryLog::isSlow(micros))
+    {
+        SlowQueryLog::capture(site, query, vector<string>(), micros);
+    }
+}
+
+// ============================================================================
+// 3/8 ~RowStream (Destructor)
+// ============================================================================
+RowStream::~RowStream()
+{
+    // mysql_free_result drains any unread rows so the connection is usable again
+    bool broken = failed();
+    if (res)
+    {
+        mysql_free_result(res);
+    }
+
+    // The whole stream (first byte to last row) counts as one sample
+    uint64_t micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    QueryMetrics::record(site, micros, rows, bytes, broken);
+}
+
+// ============================================================================
+// 4/8 ok / failed
+// ============================================================================
+bool RowStream::ok() const
+{
+    return res != nullptr;
+}
+
+bool RowStream::failed()
+{
+    // An unbuffered read can break mid-way; errors surface after the last row
+    return !res || mysql_errno(conn) != 0;
+}
+
+// ============================================================================
+// 5/8 begin / end / next
+// ============================================================================
+RowStream::iterator RowStream::begin()
+{
+    return iterator(this, next());
+}
+
+RowStream::iterator RowStream::end()
+{
+    return iterator(this, nullptr);
+}
+
+MYSQL_ROW RowStream::next()
+{
+    if (!res)
+    {
+        return nullptr;
+    }
+
+    MYSQL_ROW row = mysql_fetch_row(res);
+    if (row)
+    {
+        rows++;
+        unsigned long* lengths = mysql_fetch_lengths(res);
+        for (unsigned int i = 0, n = mysql_num_fields(res); i < n; i++) bytes += lengths[i];
+    }
+    return row;
+}
+
+// ============================================================================
+// 6/8 fieldCount / fields / lengths / rowsRead
+// ============================================================================
+unsigned int RowStream::fieldCount()
+{
+    return res ? mysql_num_fields(res) : 0;
+}
+
+MYSQL_FIELD* RowStream::fields()
+{
+    return res ? mysql_fetch_fields(res) : nullptr;
+}
+
+unsigned long* RowStream::lengths()
+{
+    return res ? mysql_fetch_lengths(res) : nullptr;
+}
+
+unsigned long long RowStream::rowsRead() const
+{
+    return rows;
+}
+
+// ============================================================================
+// 7/8 StreamProgress
+// ============================================================================
+StreamProgress::StreamProgress(const string& l)
+{
+    label = l;
+    start = chrono::steady_clock::now();
+    lastPrint = start;
+}
+
+void StreamProgress::tick(unsigned long long rows)
+{
+    // Cheap check first: only look at the clock every 1024 rows
+    if ((rows & 1023) != 0)
+    {
+        return;
+    }
+
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    if (now - lastPrint < chrono::milliseconds(250))
+    {
+        return;
+    }
+    lastPrint = now;
+    print(rows, chrono::duration<double>(now - start).count());
+}
+
+void StreamProgress::finish(unsigned long long rows)
+{
+    print(rows, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    cout << "\n";
+}
+
+// ============================================================================
+// 8/8 StreamProgress::print
+// ============================================================================
+void StreamProgress::print(unsigned long long rows, double elapsed)
+{
+    // Whole numbers only, so the shared cout precision is left untouched
+    unsigned long long rate = (elapsed > 0) ? (unsigned long long)(rows / elapsed) : 0;
+    cout << "\r   " << label << ": " << rows << " rows (" << rate << " rows/s)   " << flush;
+}
\ No newline at end of file
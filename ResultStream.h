@@ -0,0 +1,90 @@
+// ============================================================================
+// RESULT STREAM HEADER
+// ============================================================================
+#ifndef RESULT_STREAM_H
+#define RESULT_STREAM_H
+
+// External Libraries
+#include <mysql.h>      // MySQL C API (unbuffered result sets)
+#include <string>       // Query text
+#include <chrono>       // Progress timing
+#include <cstdint>      // Byte counters
+
+using namespace std;
+
+// ============================================================================
+// RowStream
+// Unbuffered result set built on mysql_use_result. Rows are pulled from the
+// socket one at a time, so client memory stays flat regardless of row count.
+// The connection cannot run other queries until the stream is destroyed.
+// ============================================================================
+class RowStream
+{
+public:
+    // ============================================================================
+    // iterator (Input Iterator Over MYSQL_ROW)
+    // ============================================================================
+    class iterator
+    {
+    public:
+        iterator(RowStream* s, MYSQL_ROW r);
+        MYSQL_ROW operator*() const;
+        iterator& operator++();
+        bool operator!=(const iterator& other) const;
+
+    private:
+        RowStream* stream; // Owning stream
+        MYSQL_ROW row;     // Current row (nullptr at end)
+    };
+
+    // ============================================================================
+    // Constructor / Destructor
+    // ============================================================================
+    RowStream(MYSQL* c, const string& query, const char* callSite = "RowStream");
+    ~RowStream();
+
+    // ============================================================================
+    // Access
+    // ============================================================================
+    bool ok() const;
+    bool failed();
+    iterator begin();
+    iterator end();
+    MYSQL_ROW next();
+    unsigned int fieldCount();
+    MYSQL_FIELD* fields();
+    unsigned long* lengths();
+    unsigned long long rowsRead() const;
+
+private:
+    RowStream(const RowStream&) = delete;
+    RowStream& operator=(const RowStream&) = delete;
+
+    MYSQL* conn;              // Connection streaming the result
+    MYSQL_RES* res;           // Unbuffered result handle
+    unsigned long long rows;  // Rows consumed so far
+    uint64_t bytes;           // Cell bytes consumed so far
+    const char* site;         // Call-site name for QueryMetrics
+    chrono::steady_clock::time_point start; // Query start time
+};
+
+// ============================================================================
+// StreamProgress
+// Prints "N rows (X rows/s)" on one console line at a bounded refresh rate.
+// ============================================================================
+class StreamProgress
+{
+public:
+    StreamProgress(const string& label);
+    void tick(unsigned long long rows);
+    void finish(unsigned long long rows);
+
+private:
+    string label;                                  // Prefix shown before the counters
+    chrono::steady_clock::time_point start;        // Stream start time
+    chrono::steady_clock::time_point lastPrint;    // Last console refresh
+
+    void print(unsigned long long rows, double elapsed);
+};
+
+#endif
\ No newline at end of file
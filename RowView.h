@@ -0,0 +1,148 @@
+// ============================================================================
+// ROW VIEW HEADER
+// ============================================================================
+#ifndef ROW_VIEW_H
+#define ROW_VIEW_H
+
+// External Libraries
+#include <mysql.h>      // MySQL C API (MYSQL_ROW, mysql_fetch_lengths)
+#include <string_view>  // Zero-copy text cells
+#include <charconv>     // from_chars integer parsing
+#include <tuple>        // Compile-time column type list
+#include <cstddef>      // size_t
+
+using namespace std;
+
+// ============================================================================
+// Money
+// DECIMAL cell held as integer cents (no floating-point parsing).
+// ============================================================================
+struct Money
+{
+    long long cents;
+
+    double toDouble() const { return cents / 100.0; }
+};
+
+// ============================================================================
+// Date
+// DATE / DATETIME cell, only the calendar part is decoded.
+// ============================================================================
+struct Date
+{
+    int year;
+    int month;
+    int day;
+};
+
+// ============================================================================
+// parseCell
+// One overload per supported column type. Empty / NULL cells yield zero.
+// ============================================================================
+inline void parseCell(string_view s, string_view& out)
+{
+    out = s;
+}
+
+inline void parseCell(string_view s, long long& out)
+{
+    out = 0;
+    from_chars(s.data(), s.data() + s.size(), out);
+}
+
+inline void parseCell(string_view s, int& out)
+{
+    out = 0;
+    from_chars(s.data(), s.data() + s.size(), out);
+}
+
+inline void parseCell(string_view s, Money& out)
+{
+    out.cents = 0;
+    const char* p = s.data();
+    const char* end = p + s.size();
+    bool negative = (p < end && *p == '-');
+    if (negative) p++;
+
+    // --------------------------------------------------
+    // Whole Part, Then Up To Two Fraction Digits
+    // --------------------------------------------------
+    long long whole = 0;
+    p = from_chars(p, end, whole).ptr;
+    long long frac = 0;
+    if (p < end && *p == '.')
+    {
+        p++;
+        for (int digits = 0; digits < 2; digits++)
+        {
+            frac *= 10;
+            if (p < end && *p >= '0' && *p <= '9') frac += *p++ - '0';
+        }
+    }
+
+    out.cents = whole * 100 + frac;
+    if (negative) out.cents = -out.cents;
+}
+
+inline void parseCell(string_view s, Date& out)
+{
+    out.year = out.month = out.day = 0;
+    if (s.size() < 10)
+    {
+        return;
+    }
+    from_chars(s.data(), s.data() + 4, out.year);
+    from_chars(s.data() + 5, s.data() + 7, out.month);
+    from_chars(s.data() + 8, s.data() + 10, out.day);
+}
+
+// ============================================================================
+// RowView
+// Typed, non-owning view over one MYSQL_ROW. The column types are fixed at
+// compile time per query, e.g. RowView<string_view, Money> for (date, sum).
+// Cells are decoded in place using mysql_fetch_lengths; nothing is copied.
+// ============================================================================
+template <typename... Cols>
+class RowView
+{
+public:
+    static constexpr size_t columnCount = sizeof...(Cols);
+
+    RowView(MYSQL_ROW r, unsigned long* l)
+    {
+        row = r;
+        lengths = l;
+    }
+
+    // #### Shape Check ####
+    // True when the result set has exactly the columns this view expects
+    static bool matches(MYSQL_RES* res)
+    {
+        return res && mysql_num_fields(res) == columnCount;
+    }
+
+    bool isNull(size_t i) const
+    {
+        return row[i] == nullptr;
+    }
+
+    string_view text(size_t i) const
+    {
+        return row[i] ? string_view(row[i], lengths[i]) : string_view();
+    }
+
+    template <size_t I>
+    typename tuple_element<I, tuple<Cols...>>::type get() const
+    {
+        static_assert(I < columnCount, "RowView column index out of range");
+        typename tuple_element<I, tuple<Cols...>>::type value;
+        parseCell(text(I), value);
+        return value;
+    }
+
+private:
+    MYSQL_ROW row;           // Borrowed row pointers (valid until next fetch)
+    unsigned long* lengths;  // Borrowed cell lengths
+};
+
+#endif
\ No newline at end of file
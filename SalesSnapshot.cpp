@@ -0,0 +1,390 @@
+// ============================================================================
+// SALES SNAPSHOT IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "SalesSnapshot.h"
+#include "Format.h"       // Day numbers and period keys
+#include "AggregateKernels.h" // Filtered sums and group-by over the columns
+
+// Standard Libraries
+#include <map>            // Period keys in report order
+#include <mutex>          // Snapshot lock
+#include <algorithm>      // lower_bound, reverse, min, max
+#include <cstdint>        // Fixed-width columns
+#include <chrono>         // Prune interval
+
+using namespace std;
+
+// Order facts in parallel columns; element i of each belongs to the same order
+struct SalesColumns
+{
+    vector<long long> id;       // Ascending
+    vector<int32_t> day;        // Format::dayNumber
+    vector<uint16_t> product;
+    vector<int32_t> quantity;
+    vector<int64_t> cents;
+    vector<uint8_t> status;     // Index into statusNames, REMOVED once deleted
+};
+
+static const uint8_t REMOVED = 255;
+
+// Rows keyed per kernel call (16 KB of keys, stays in L1)
+static const size_t GROUP_BLOCK_ROWS = 4096;
+
+static mutex snapshotLock;      // Guards everything below
+static SalesColumns cols;
+static vector<string> statusNames;
+static int32_t firstDay = 0;    // Day span seen so far (not narrowed by deletes)
+static int32_t lastDay = -1;
+static int maxProduct = 0;
+static long long watermark = 0; // Change feed version applied up to
+static bool loaded = false;
+static bool unfit = false;      // Orders outgrew the columns; reports use the store
+static chrono::steady_clock::time_point lastPrune;  // Last change feed prune from this process
+
+static const string FEED_READER = "sales-snapshot";  // Change feed reader name
+static const int PRUNE_EVERY_MINUTES = 15;
+
+// Empties the snapshot so the next feed read is a full load; caller holds snapshotLock
+static void clearColumns()
+{
+    cols = SalesColumns();
+    statusNames.clear();
+    firstDay = 0;
+    lastDay = -1;
+    maxProduct = 0;
+    watermark = 0;
+    loaded = false;
+}
+
+// Status code for a status name, registering it on first sight
+static bool statusCode(const string& name, uint8_t& code)
+{
+    for (size_t i = 0; i < statusNames.size(); i++)
+    {
+        if (statusNames[i] == name)
+        {
+            code = (uint8_t)i;
+            return true;
+        }
+    }
+    if (statusNames.size() >= REMOVED)
+    {
+        return false;
+    }
+    code = (uint8_t)statusNames.size();
+    statusNames.push_back(name);
+    return true;
+}
+
+// Inserts or overwrites one order's row; caller holds snapshotLock
+static bool apply(const OrderFact& f)
+{
+    size_t i = lower_bound(cols.id.begin(), cols.id.end(), f.id) - cols.id.begin();
+    bool present = i < cols.id.size() && cols.id[i] == f.id;
+    if (f.removed)
+    {
+        if (present) cols.status[i] = REMOVED;
+        return true;
+    }
+
+    // #### Column Range Check ####
+    uint8_t code;
+    if (f.productId < 0 || f.productId > UINT16_MAX || !statusCode(f.status, code))
+    {
+        return false;
+    }
+
+    if (!present)
+    {
+        // New orders arrive in id order, so this is almost always an append
+        cols.id.insert(cols.id.begin() + i, f.id);
+        cols.day.insert(cols.day.begin() + i, 0);
+        cols.product.insert(cols.product.begin() + i, 0);
+        cols.quantity.insert(cols.quantity.begin() + i, 0);
+        cols.cents.insert(cols.cents.begin() + i, 0);
+        cols.status.insert(cols.status.begin() + i, 0);
+    }
+    cols.day[i] = f.day;
+    cols.product[i] = (uint16_t)f.productId;
+    cols.quantity[i] = f.quantity;
+    cols.cents[i] = f.cents;
+    cols.status[i] = code;
+
+    if (lastDay < firstDay) firstDay = lastDay = f.day;
+    firstDay = min(firstDay, (int32_t)f.day);
+    lastDay = max(lastDay, (int32_t)f.day);
+    maxProduct = max(maxProduct, f.productId);
+    return true;
+}
+
+// Best and worst sellers (by units) from per-item totals; ties go to the first name
+static pair<ItemQty, ItemQty> pickBestWorst(const map<string, long long>& units)
+{
+    pair<ItemQty, ItemQty> items(ItemQty{"-", 0}, ItemQty{"-", 0});
+    bool first = true;
+    for (const auto& u : units)
+    {
+        if (first || u.second > items.first.qty)  items.first = ItemQty{u.first, u.second};
+        if (first || u.second < items.second.qty) items.second = ItemQty{u.first, u.second};
+        first = false;
+    }
+    return items;
+}
+
+// ============================================================================
+// 1/4 refresh
+// ============================================================================
+bool SalesSnapshot::refresh(DataStore& store)
+{
+    lock_guard<mutex> guard(snapshotLock);
+    if (unfit)
+    {
+        return false;
+    }
+
+    // #### First Use ####
+    if (!loaded)
+    {
+        clearColumns();
+    }
+
+    // #### Empty Feed Check ####
+    // Version 0 asks for a full load, so over an empty feed (a fresh install) the loaded
+    // snapshot only reads the feed again once something has changed
+    if (loaded && watermark == 0)
+    {
+        long long head = 0;
+        if (!store.orders().latestChangeVersion(FEED_READER, head))
+        {
+            return false;
+        }
+        if (head == 0)
+        {
+            return true;
+        }
+    }
+
+    // Full load at version 0, otherwise only the orders changed since
+    long long version = watermark;
+    bool fits = true;
+    auto visit = [&](const OrderFact& f)
+    {
+        if (fits && !apply(f)) fits = false;
+    };
+    bool ok = store.orders().forEachChange(FEED_READER, version, visit);
+
+    // #### Pruned Feed Check ####
+    // Away long enough for the changes it needed to be pruned: start over from a full load
+    if (ok && watermark > 0 && version == 0)
+    {
+        clearColumns();
+        fits = true;
+        ok = store.orders().forEachChange(FEED_READER, version, visit);
+    }
+
+    // #### Fit Check ####
+    if (!fits)
+    {
+        unfit = true;
+        loaded = false;
+        cols = SalesColumns();
+        return false;
+    }
+    if (!ok)
+    {
+        // A partial full load is dropped; a partial delta is kept (facts are idempotent) and replayed
+        if (!loaded) cols = SalesColumns();
+        return false;
+    }
+    watermark = version;
+    loaded = true;
+
+    // --------------------------------------------------
+    // Prune The Feed Now And Then
+    // --------------------------------------------------
+    // Only changes every active reader has read are removed; a failure just leaves them for next time
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    if (lastPrune == chrono::steady_clock::time_point() || now - lastPrune >= chrono::minutes(PRUNE_EVERY_MINUTES))
+    {
+        lastPrune = now;
+        long long removed = 0;
+        store.orders().pruneChanges(removed);
+    }
+    return true;
+}
+
+// ============================================================================
+// 2/4 salesTrend
+// ============================================================================
+bool SalesSnapshot::salesTrend(const PeriodScope& scope, const CatalogSnapshot& catalog,
+                               vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall)
+{
+    lock_guard<mutex> guard(snapshotLock);
+    out.clear();
+    overall = pair<ItemQty, ItemQty>(ItemQty{"-", 0}, ItemQty{"-", 0});
+    if (!loaded)
+    {
+        return false;
+    }
+
+    // #### No Completed Orders Check ####
+    vector<string>::iterator c = find(statusNames.begin(), statusNames.end(), "Completed");
+    if (c == statusNames.end())
+    {
+        return true;
+    }
+    uint8_t completed = (uint8_t)(c - statusNames.begin());
+
+    // --------------------------------------------------
+    // Day Range And Day -> Period Table
+    // --------------------------------------------------
+    int32_t from = firstDay;
+    int32_t to = lastDay + 1;
+    if (scope.year > 0)
+    {
+        bool oneMonth = scope.month > 0;
+        from = max(from, (int32_t)Format::dayNumber(scope.year, oneMonth ? scope.month : 1, 1));
+        to = min(to, (int32_t)(oneMonth ? Format::dayNumber(scope.month == 12 ? scope.year + 1 : scope.year, scope.month % 12 + 1, 1)
+                                        : Format::dayNumber(scope.year + 1, 1, 1)));
+    }
+    if (from >= to)
+    {
+        return true;
+    }
+
+    // Periods get dense indexes; the map keeps their keys in report order
+    map<string, int32_t> periodOf;
+    vector<int32_t> dayPeriod(to - from, -1);
+    for (int32_t d = from; d < to; d++)
+    {
+        int y, m, dd;
+        Format::civilDate(d, y, m, dd);
+
+        // Month filter without a year cannot narrow the range
+        if (scope.year == 0 && scope.month > 0 && m != scope.month) continue;
+
+        char key[Format::DATE_LEN + 1];
+        Format::writeDay(key, d);
+        string k;
+        if (scope.unit == Period::Day)        k.assign(key, 10);
+        else if (scope.unit == Period::Week)  k = to_string((dd - 1) / 7 + 1);
+        else if (scope.unit == Period::Month) k.assign(key, 7);
+        else                                  k.assign(key, 4);
+
+        auto it = periodOf.insert(make_pair(k, (int32_t)periodOf.size())).first;
+        dayPeriod[d - from] = it->second;
+    }
+
+    // Catalog products get item slots from 1; slot 0 collects unknown products (revenue only)
+    vector<int32_t> slotOf(maxProduct + 1, 0);
+    vector<const Product*> slotProduct(1, nullptr);
+    for (const Product& p : catalog.products)
+    {
+        if (p.id < 0 || p.id > maxProduct) continue;
+        slotOf[p.id] = (int32_t)slotProduct.size();
+        slotProduct.push_back(&p);
+    }
+
+    // --------------------------------------------------
+    // One Pass Over The Columns, Grouped By (Period, Slot)
+    // --------------------------------------------------
+    size_t periods = periodOf.size();
+    size_t slots = slotProduct.size();
+    vector<int64_t> cents(periods * slots, 0);
+    vector<int64_t> units(periods * slots, 0);
+    vector<int64_t> cellOrders(periods * slots, 0);
+
+    // Keys are built a cache-sized block at a time, then summed while still hot
+    const KernelSet& kernels = AggregateKernels::active();
+    RowFilter filter{completed, from, to};
+    int32_t keys[GROUP_BLOCK_ROWS];
+    size_t n = cols.id.size();
+    for (size_t at = 0; at < n; at += GROUP_BLOCK_ROWS)
+    {
+        size_t len = min(GROUP_BLOCK_ROWS, n - at);
+        kernels.groupKeys(&cols.status[at], &cols.day[at], &cols.product[at], len, filter,
+                          dayPeriod.data(), slotOf.data(), (int32_t)slots, keys);
+        kernels.groupSum(keys, &cols.cents[at], &cols.quantity[at], len, cents.data(), units.data(), cellOrders.data());
+    }
+
+    // --------------------------------------------------
+    // Reduce Into Periods And Overall Totals
+    // --------------------------------------------------
+    // Same-named products merge, as the engines group by name
+    map<string, long long> allUnits;
+    vector<PeriodSales> rows;
+    for (const auto& k : periodOf)
+    {
+        size_t first = (size_t)k.second * slots;
+        int64_t revenue = 0;
+        int64_t orders = 0;
+        map<string, long long> periodUnits;
+        for (size_t s = 0; s < slots; s++)
+        {
+            revenue += cents[first + s];
+            orders += cellOrders[first + s];
+            if (s == 0 || cellOrders[first + s] == 0) continue;
+            periodUnits[slotProduct[s]->name] += units[first + s];
+            allUnits[slotProduct[s]->name] += units[first + s];
+        }
+        if (orders == 0) continue;
+
+        pair<ItemQty, ItemQty> items = pickBestWorst(periodUnits);
+        rows.push_back(PeriodSales{k.first, revenue / 100.0, items.first, items.second});
+    }
+    overall = pickBestWorst(allUnits);
+
+    // #### Period Limit Check ####
+    // Periods past the limit still count towards the overall items
+    if (scope.newestFirst) reverse(rows.begin(), rows.end());
+    if (scope.limit > 0 && (int)rows.size() > scope.limit) rows.resize(scope.limit);
+    out.swap(rows);
+    return true;
+}
+
+// ============================================================================
+// 3/4 completedSummary
+// ============================================================================
+bool SalesSnapshot::completedSummary(CompletedSummary& out)
+{
+    lock_guard<mutex> guard(snapshotLock);
+    out = CompletedSummary{0, 0.0, 0.0, 0.0};
+
+    vector<string>::iterator c = find(statusNames.begin(), statusNames.end(), "Completed");
+    if (!loaded || c == statusNames.end())
+    {
+        return loaded;
+    }
+
+    // Every day: the filter's range is the whole int32 span
+    const KernelSet& kernels = AggregateKernels::active();
+    RowFilter filter{(uint8_t)(c - statusNames.begin()), INT32_MIN, INT32_MAX};
+    size_t n = cols.id.size();
+    int64_t lowest;
+    int64_t highest;
+    if (!kernels.minMax(cols.cents.data(), cols.status.data(), cols.day.data(), n, filter, lowest, highest))
+    {
+        return true;
+    }
+    out.orders = (long long)kernels.count(cols.status.data(), cols.day.data(), n, filter);
+    out.revenue = kernels.sum(cols.cents.data(), cols.status.data(), cols.day.data(), n, filter) / 100.0;
+    out.lowest = lowest / 100.0;
+    out.highest = highest / 100.0;
+    return true;
+}
+
+// ============================================================================
+// 4/4 rows / version
+// ============================================================================
+size_t SalesSnapshot::rows()
+{
+    lock_guard<mutex> guard(snapshotLock);
+    return cols.id.size();
+}
+
+long long SalesSnapshot::version()
+{
+    lock_guard<mutex> guard(snapshotLock);
+    return watermark;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+// ============================================================================
+// SALES SNAPSHOT HEADER
+// ============================================================================
+#ifndef SALES_SNAPSHOT_H
+#define SALES_SNAPSHOT_H
+
+// Internal Headers
+#include "Repository.h"       // Order facts, report records and data store
+#include "ProductCatalog.h"   // Product names for best / worst items
+
+// Standard Libraries
+#include <vector>             // Report rows
+#include <utility>            // Best / worst pairs
+#include <cstddef>            // size_t
+
+using namespace std;
+
+// ============================================================================
+// CompletedSummary
+// Totals over every Completed order in the snapshot.
+// ============================================================================
+struct CompletedSummary
+{
+    long long orders;
+    double revenue;
+    double lowest;           // Smallest and largest order total (0 when no orders)
+    double highest;
+};
+
+// ============================================================================
+// SalesSnapshot
+// Process-wide, column-per-field copy of the order history for the report
+// screens: day number (int32), product id (uint16), quantity (int32), price
+// in cents (int64) and a status code (uint8), one element per order in
+// parallel arrays sorted by order id (27 bytes a row with the id column).
+// The first refresh loads every order; later ones replay the change feed past
+// the version watermark, so orders placed, re-statused or deleted on any
+// terminal show up without a reload. Reports aggregate here instead of
+// asking the database, so they stay fast while it is busy taking orders;
+// the scans run through AggregateKernels (AVX2 where the CPU has it).
+// ============================================================================
+class SalesSnapshot
+{
+public:
+    // false when the store failed (its lastError() says why) or the orders do
+    // not fit the columns (product id above 65535, more than 255 statuses)
+    static bool refresh(DataStore& store);
+
+    // OrderRepository::salesTrend over the snapshot, Completed orders only
+    static bool salesTrend(const PeriodScope& scope, const CatalogSnapshot& catalog,
+                           vector<PeriodSales>& out, pair<ItemQty, ItemQty>& overall);
+
+    // false until a refresh has loaded the snapshot
+    static bool completedSummary(CompletedSummary& out);
+
+    static size_t rows();
+    static long long version();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+// ============================================================================
+// SELECTABLE LISTING IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "SelectableListing.h"
+
+// Standard Libraries
+#include <iostream>    // Prompt output (cout)
+#include "Utils.h"     // Shared Utility Functions
+
+using namespace std;
+
+// ============================================================================
+// 1/3 clear / add
+// ============================================================================
+void SelectableListing::clear()
+{
+    keys.clear();
+}
+
+int SelectableListing::add(const string& key)
+{
+    keys.push_back(key);
+    return (int)keys.size();
+}
+
+// ============================================================================
+// 2/3 size / empty
+// ============================================================================
+int SelectableListing::size() const
+{
+    return (int)keys.size();
+}
+
+bool SelectableListing::empty() const
+{
+    return keys.empty();
+}
+
+// ============================================================================
+// 3/3 select
+// ============================================================================
+string SelectableListing::select(const string& prompt) const
+{
+    cout << prompt;
+    int sel = Utils::getValidRange(0, size());
+
+    // #### Cancel Check ####
+    if (sel == 0)
+    {
+        return "";
+    }
+    return keys[sel - 1];
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+// ============================================================================
+// SELECTABLE LISTING HEADER
+// ============================================================================
+#ifndef SELECTABLE_LISTING_H
+#define SELECTABLE_LISTING_H
+
+// Standard Libraries
+#include <string>       // Row keys
+#include <vector>       // Rendered rows
+
+using namespace std;
+
+// ============================================================================
+// SelectableListing
+// Client-side selection buffer for a numbered table. A screen adds each row's
+// key (e.g. the order's smart_id) as it prints the row, then resolves the
+// number the clerk types against exactly the rows that were on screen.
+// ============================================================================
+class SelectableListing
+{
+public:
+    void clear();
+    int add(const string& key);   // Returns the row number to print
+    int size() const;
+    bool empty() const;
+
+    // Prompts for a row number (0 = cancel); returns its key, or "" when cancelled
+    string select(const string& prompt) const;
+
+private:
+    vector<string> keys; // Key of row N at index N-1
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+// ============================================================================
+// SLOW QUERY LOG IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "SlowQueryLog.h"
+#include "DatabaseConnection.h"   // Side connection for EXPLAIN
+#include "Format.h"               // Entry timestamps (any thread)
+
+// Standard Libraries
+#include <fstream>     // Log file output
+#include <iomanip>     // Formatting (setprecision)
+#include <atomic>      // Lock-free threshold reads
+#include <mutex>       // Log file locking
+#include <ctime>       // Timestamps
+#include <cctype>      // Statement keyword check
+
+using namespace std;
+
+static DatabaseConnection* explainPool = nullptr;
+static atomic<uint64_t> thresholdMicros(500000);
+static string logFile = "FAIX_Slow_Queries.log";
+static mutex logLock;
+
+// ============================================================================
+// 1/6 configure
+// ============================================================================
+void SlowQueryLog::configure(DatabaseConnection* pool, uint64_t thresholdMs, const string& filename)
+{
+    lock_guard<mutex> guard(logLock);
+    explainPool = pool;
+    logFile = filename;
+    thresholdMicros = thresholdMs * 1000;
+}
+
+// ============================================================================
+// 2/6 setThreshold / threshold / isSlow
+// ============================================================================
+void SlowQueryLog::setThreshold(uint64_t thresholdMs)
+{
+    thresholdMicros = thresholdMs * 1000;
+}
+
+uint64_t SlowQueryLog::threshold()
+{
+    return thresholdMicros / 1000;
+}
+
+bool SlowQueryLog::isSlow(uint64_t micros)
+{
+    // Checked on every query, so this stays a single atomic load
+    return micros >= thresholdMicros;
+}
+
+// ============================================================================
+// 3/6 isExplainable (Local Helper)
+// ============================================================================
+static bool isExplainable(const string& sql)
+{
+    // Batches are never explained: the side connection would run the trailing statements.
+    // Checked on the template, so a ';' inside a bound value does not count.
+    if (sql.find(';') != string::npos)
+    {
+        return false;
+    }
+
+    size_t i = sql.find_first_not_of(" \t\r\n(");
+    if (i == string::npos)
+    {
+        return false;
+    }
+
+    string verb;
+    while (i < sql.length() && isalpha((unsigned char)sql[i]))
+    {
+        verb += (char)toupper((unsigned char)sql[i++]);
+    }
+    return verb == "SELECT" || verb == "INSERT" || verb == "UPDATE" || verb == "DELETE" || verb == "REPLACE";
+}
+
+// ============================================================================
+// 4/6 inlineParams (Local Helper)
+// ============================================================================
+static string inlineParams(const string& sql, const vector<string>& params)
+{
+    // Parameters arrive as ready-to-use SQL literals; substitute them in order
+    string out;
+    size_t next = 0;
+    for (char c : sql)
+    {
+        if (c == '?' && next < params.size())
+        {
+            out += params[next++];
+        }
+        else
+        {
+            out += c;
+        }
+    }
+    return out;
+}
+
+// ============================================================================
+// 5/6 explain (Local Helper)
+// ============================================================================
+static string explain(const string& sql, const string& concrete)
+{
+    if (!explainPool || !isExplainable(sql))
+    {
+        return "(not captured)";
+    }
+
+    // --------------------------------------------------
+    // Borrow An Idle Side Connection Without Waiting
+    // --------------------------------------------------
+    DatabaseConnection::Handle side = explainPool->tryAcquire();
+    if (!side.get())
+    {
+        return "(not captured: no idle connection)";
+    }
+
+    string q = "EXPLAIN FORMAT=JSON " + concrete;
+    if (mysql_real_query(side.get(), q.c_str(), q.length()))
+    {
+        return string("(EXPLAIN failed: ") + mysql_error(side.get()) + ")";
+    }
+
+    MYSQL_RES* res = mysql_store_result(side.get());
+    string plan = "(no plan)";
+    MYSQL_ROW row = res ? mysql_fetch_row(res) : nullptr;
+    if (row && row[0])
+    {
+        plan = row[0];
+    }
+    if (res)
+    {
+        mysql_free_result(res);
+    }
+    return plan;
+}
+
+// ============================================================================
+// 6/6 capture
+// ============================================================================
+void SlowQueryLog::capture(const string& site, const string& sql, const vector<string>& params, uint64_t micros)
+{
+    // Plan is fetched before taking the log lock so writers never wait on the server
+    string concrete = params.empty() ? sql : inlineParams(sql, params);
+    string plan = explain(sql, concrete);
+
+    lock_guard<mutex> guard(logLock);
+    ofstream out(logFile, ios::app);
+    if (!out)
+    {
+        return;
+    }
+
+    char stamp[Format::STAMP_LEN + 1];
+    Format::writeStamp(stamp, time(0));
+
+    // --------------------------------------------------
+    // Write Entry
+    // --------------------------------------------------
+    out << "==================================================================\n";
+    out << stamp << "  " << site << "  " << fixed << setprecision(1) << micros / 1000.0 << " ms\n";
+    out << "SQL    : " << sql << "\n";
+    if (!params.empty())
+    {
+        out << "PARAMS : ";
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            out << (i ? ", " : "") << params[i];
+        }
+        out << "\n";
+    }
+    out << "PLAN   :\n" << plan << "\n\n";
+}
\ No newline at end of file
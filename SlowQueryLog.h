@@ -0,0 +1,34 @@
+// ============================================================================
+// SLOW QUERY LOG HEADER
+// ============================================================================
+#ifndef SLOW_QUERY_LOG_H
+#define SLOW_QUERY_LOG_H
+
+// External Libraries
+#include <string>       // SQL text and parameters
+#include <vector>       // Parameter lists
+#include <cstdint>      // Microsecond counters
+
+using namespace std;
+
+class DatabaseConnection;
+
+// ============================================================================
+// SlowQueryLog
+// Queries slower than the threshold are appended to a log file together with
+// their parameters and the EXPLAIN FORMAT=JSON plan. The plan is captured on
+// a side connection leased from the pool, never on the caller's connection.
+// Parameters arrive as SQL literals; secrets (PreparedQuery::bindSecret) are
+// already '***' by then, in the PARAMS line and in the EXPLAINed text alike.
+// ============================================================================
+class SlowQueryLog
+{
+public:
+    static void configure(DatabaseConnection* pool, uint64_t thresholdMs, const string& filename);
+    static void setThreshold(uint64_t thresholdMs);
+    static uint64_t threshold();
+    static bool isSlow(uint64_t micros);
+    static void capture(const string& site, const string& sql, const vector<string>& params, uint64_t micros);
+};
+
+#endif
\ No newline at end of file
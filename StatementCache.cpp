@@ -0,0 +1,558 @@
+// ============================================================================
+// STATEMENT CACHE IMPLEMENTATION
+// ============================================================================
+// Internal Headers
+#include "StatementCache.h"
+#include "QueryMetrics.h"    // Per-call-site latency recording
+#include "SlowQueryLog.h"    // Slow statement capture
+#include <mysqld_error.h>    // Server error codes
+
+// Standard Libraries
+#include <iostream>        // Error logging (cerr)
+#include <cstdio>          // snprintf for value formatting
+#include <cstdlib>         // atoll / atof for text columns
+#include <cstring>         // memset for bind structures
+#include <map>             // Connection registry
+#include <unordered_map>   // Per-connection template lookup
+#include <mutex>           // Registry locking
+#include <chrono>          // Execution timing
+
+using namespace std;
+
+// Statements are registered per connection so modules can keep passing MYSQL*
+static map<MYSQL*, unordered_map<string, MYSQL_STMT*>> registry;
+static map<MYSQL*, unsigned long> epochs;   // Bumped whenever a connection's statements are closed
+static mutex registryLock;
+
+// ============================================================================
+// 1/15 StatementCache::get
+// ============================================================================
+MYSQL_STMT* StatementCache::get(MYSQL* conn, const string& sql)
+{
+    lock_guard<mutex> guard(registryLock);
+    unordered_map<string, MYSQL_STMT*>& stmts = registry[conn];
+
+    // #### Cache Hit Check ####
+    unordered_map<string, MYSQL_STMT*>::iterator it = stmts.find(sql);
+    if (it != stmts.end())
+    {
+        return it->second;
+    }
+
+    // --------------------------------------------------
+    // Prepare On First Use
+    // --------------------------------------------------
+    MYSQL_STMT* stmt = mysql_stmt_init(conn);
+    if (!stmt)
+    {
+        return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), sql.length()))
+    {
+        cerr << "\033[1;31m   [ERROR] Prepare failed: " << mysql_stmt_error(stmt) << "\033[0m" << endl;
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    // Ask for max_length so text buffers can be sized exactly
+    my_bool updateMax = 1;
+    mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &updateMax);
+
+    stmts[sql] = stmt;
+    return stmt;
+}
+
+// ============================================================================
+// 2/15 StatementCache::release / epoch
+// ============================================================================
+void StatementCache::release(MYSQL* conn)
+{
+    lock_guard<mutex> guard(registryLock);
+    epochs[conn]++;
+    map<MYSQL*, unordered_map<string, MYSQL_STMT*>>::iterator it = registry.find(conn);
+
+    if (it == registry.end())
+    {
+        return;
+    }
+
+    // --------------------------------------------------
+    // Close Every Statement On This Connection
+    // --------------------------------------------------
+    for (auto& entry : it->second)
+    {
+        mysql_stmt_close(entry.second);
+    }
+    registry.erase(it);
+}
+
+unsigned long StatementCache::epoch(MYSQL* conn)
+{
+    lock_guard<mutex> guard(registryLock);
+    return epochs[conn];
+}
+
+// ============================================================================
+// 3/15 PreparedQuery (Constructor)
+// ============================================================================
+PreparedQuery::PreparedQuery(MYSQL* c, const string& sqlTemplate, const char* callSite)
+{
+    conn = c;
+    sql = sqlTemplate;
+    hasResult = false;
+    site = callSite;
+    fetchedBytes = 0;
+    idempotent = false;
+    lostConnection = false;
+    stmt = StatementCache::get(conn, sqlTemplate);
+    stmtEpoch = StatementCache::epoch(conn);
+
+    // #### Dead Session Check ####
+    // Preparing has no side effects, so it is always safe to redo on a restored session.
+    // The failed prepare leaves no error on conn, hence the ping to classify it.
+    if (!stmt && mysql_ping(conn) != 0 && QueryExecutor::recover(conn))
+    {
+        stmt = StatementCache::get(conn, sqlTemplate);
+        stmtEpoch = StatementCache::epoch(conn);
+    }
+
+    // --------------------------------------------------
+    // Size Parameter Storage
+    // --------------------------------------------------
+    if (stmt)
+    {
+        unsigned long count = mysql_stmt_param_count(stmt);
+        params.resize(count);
+        values.resize(count);
+        memset(params.data(), 0, sizeof(MYSQL_BIND) * count);
+    }
+}
+
+// ============================================================================
+// 4/15 ~PreparedQuery (Destructor)
+// ============================================================================
+PreparedQuery::~PreparedQuery()
+{
+    // Statement stays cached; only the buffered result is dropped
+    if (!stale() && hasResult)
+    {
+        mysql_stmt_free_result(stmt);
+    }
+
+    // Result bytes are only known once the caller has fetched the rows
+    if (fetchedBytes > 0)
+    {
+        QueryMetrics::addBytes(site, fetchedBytes);
+    }
+}
+
+// ============================================================================
+// 5/15 bindInt / bindDouble / bindString / bindSecret
+// ============================================================================
+void PreparedQuery::bindInt(int idx, long long value)
+{
+    if (idx < 0 || idx >= (int)params.size()) return;
+    values[idx].i = value;
+    params[idx].buffer_type = MYSQL_TYPE_LONGLONG;
+    params[idx].buffer = &values[idx].i;
+}
+
+void PreparedQuery::bindDouble(int idx, double value)
+{
+    if (idx < 0 || idx >= (int)params.size()) return;
+    values[idx].d = value;
+    params[idx].buffer_type = MYSQL_TYPE_DOUBLE;
+    params[idx].buffer = &values[idx].d;
+}
+
+void PreparedQuery::bindString(int idx, const string& value)
+{
+    if (idx < 0 || idx >= (int)params.size()) return;
+    values[idx].s = value;
+    values[idx].length = value.length();
+    params[idx].buffer_type = MYSQL_TYPE_STRING;
+    params[idx].buffer = (void*)values[idx].s.data();
+    params[idx].buffer_length = values[idx].length;
+    params[idx].length = &values[idx].length;
+    values[idx].secret = false;
+}
+
+void PreparedQuery::bindSecret(int idx, const string& value)
+{
+    bindString(idx, value);
+    if (idx < 0 || idx >= (int)params.size()) return;
+    values[idx].secret = true;
+}
+
+// ============================================================================
+// 6/15 execute
+// ============================================================================
+bool PreparedQuery::execute()
+{
+    // #### Closed Underneath Check ####
+    // Another query on this connection reconnected it; the old statement is gone
+    if (stmt && stale())
+    {
+        stmt = StatementCache::get(conn, sql);
+        stmtEpoch = StatementCache::epoch(conn);
+        hasResult = false;
+    }
+
+    // #### Prepare Failure Check ####
+    if (!stmt)
+    {
+        return false;
+    }
+
+    if (hasResult)
+    {
+        mysql_stmt_free_result(stmt);
+        hasResult = false;
+    }
+
+    // --------------------------------------------------
+    // Send Parameters & Run
+    // --------------------------------------------------
+    lostConnection = false;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    bool ok = (params.empty() || !mysql_stmt_bind_param(stmt, params.data())) && !mysql_stmt_execute(stmt);
+
+    // #### Lost Connection Check ####
+    // The reconnect closes every cached statement, so re-prepare before anything touches stmt
+    if (!ok && QueryExecutor::recover(conn))
+    {
+        lostConnection = true;
+        stmt = StatementCache::get(conn, sql);
+        stmtEpoch = StatementCache::epoch(conn);
+        if (!stmt)
+        {
+            return false;
+        }
+
+        // Only statements marked idempotent are sent a second time
+        if (idempotent)
+        {
+            lostConnection = false;
+            start = chrono::steady_clock::now();
+            ok = (params.empty() || !mysql_stmt_bind_param(stmt, params.data())) && !mysql_stmt_execute(stmt);
+        }
+    }
+
+    // Statements without a result set (INSERT / UPDATE / DELETE) end here
+    if (!ok || mysql_stmt_field_count(stmt) == 0)
+    {
+        uint64_t micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        QueryMetrics::record(site, micros, ok ? mysql_stmt_affected_rows(stmt) : 0, 0, !ok);
+        logIfSlow(micros);
+        return ok;
+    }
+
+    // --------------------------------------------------
+    // Buffer Result Client-Side
+    // --------------------------------------------------
+    ok = !mysql_stmt_store_result(stmt);
+    uint64_t micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    QueryMetrics::record(site, micros, ok ? mysql_stmt_num_rows(stmt) : 0, 0, !ok);
+    logIfSlow(micros);
+    if (!ok)
+    {
+        return false;
+    }
+    hasResult = true;
+
+    return bindResults();
+}
+
+// ============================================================================
+// 7/15 bindResults
+// ============================================================================
+bool PreparedQuery::bindResults()
+{
+    MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
+    if (!meta)
+    {
+        return false;
+    }
+
+    unsigned int count = mysql_num_fields(meta);
+    MYSQL_FIELD* fields = mysql_fetch_fields(meta);
+    columns.assign(count, Column());
+    results.resize(count);
+    memset(results.data(), 0, sizeof(MYSQL_BIND) * count);
+
+    // --------------------------------------------------
+    // Pick A Native Buffer Per Column Type
+    // --------------------------------------------------
+    for (unsigned int i = 0; i < count; i++)
+    {
+        Column& col = columns[i];
+        MYSQL_BIND& b = results[i];
+        col.type = fields[i].type;
+        col.decimals = fields[i].decimals;
+
+        switch (col.type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_YEAR:
+                b.buffer_type = MYSQL_TYPE_LONGLONG;
+                b.buffer = &col.i;
+                break;
+
+            case MYSQL_TYPE_DECIMAL:
+            case MYSQL_TYPE_NEWDECIMAL:
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+                b.buffer_type = MYSQL_TYPE_DOUBLE;
+                b.buffer = &col.d;
+                break;
+
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP:
+            case MYSQL_TYPE_TIME:
+                b.buffer_type = col.type;
+                b.buffer = &col.t;
+                break;
+
+            default:
+                col.text.resize(fields[i].max_length + 1);
+                b.buffer_type = MYSQL_TYPE_STRING;
+                b.buffer = col.text.data();
+                b.buffer_length = col.text.size();
+                break;
+        }
+        b.length = &col.length;
+        b.is_null = &col.nullFlag;
+        b.error = &col.errorFlag;
+    }
+    mysql_free_result(meta);
+
+    return mysql_stmt_bind_result(stmt, results.data()) == 0;
+}
+
+// ============================================================================
+// 8/15 fetch
+// ============================================================================
+bool PreparedQuery::fetch()
+{
+    if (!hasResult)
+    {
+        return false;
+    }
+
+    if (stale())
+    {
+        return false;
+    }
+    int rc = mysql_stmt_fetch(stmt);
+    if (rc != 0 && rc != MYSQL_DATA_TRUNCATED)
+    {
+        return false;
+    }
+
+    for (const Column& c : columns)
+    {
+        fetchedBytes += c.nullFlag ? 0 : c.length;
+    }
+    return true;
+}
+
+// ============================================================================
+// 9/15 affectedRows / rowCount / error / transient / markIdempotent / stale
+// ============================================================================
+my_ulonglong PreparedQuery::affectedRows()
+{
+    return stale() ? 0 : mysql_stmt_affected_rows(stmt);
+}
+
+my_ulonglong PreparedQuery::rowCount()
+{
+    return (hasResult && !stale()) ? mysql_stmt_num_rows(stmt) : 0;
+}
+
+string PreparedQuery::error()
+{
+    if (lostConnection)
+    {
+        return QueryExecutor::errorText(conn);
+    }
+    return stale() ? mysql_error(conn) : mysql_stmt_error(stmt);
+}
+
+bool PreparedQuery::transient()
+{
+    // The server already rolled back the open transaction; re-running it from the start is safe
+    if (lostConnection)
+    {
+        return true;
+    }
+    unsigned int code = stale() ? mysql_errno(conn) : mysql_stmt_errno(stmt);
+    return code == ER_LOCK_DEADLOCK || code == ER_LOCK_WAIT_TIMEOUT;
+}
+
+void PreparedQuery::markIdempotent()
+{
+    idempotent = true;
+}
+
+bool PreparedQuery::stale()
+{
+    // True when there is no statement or a reconnect has closed it
+    return !stmt || StatementCache::epoch(conn) != stmtEpoch;
+}
+
+// ============================================================================
+// 10/15 isNull
+// ============================================================================
+bool PreparedQuery::isNull(int col)
+{
+    return col < 0 || col >= (int)columns.size() || columns[col].nullFlag;
+}
+
+// ============================================================================
+// 11/15 getInt
+// ============================================================================
+long long PreparedQuery::getInt(int col)
+{
+    if (isNull(col)) return 0;
+    Column& c = columns[col];
+
+    if (c.type == MYSQL_TYPE_DECIMAL || c.type == MYSQL_TYPE_NEWDECIMAL ||
+        c.type == MYSQL_TYPE_FLOAT || c.type == MYSQL_TYPE_DOUBLE)
+    {
+        return (long long)c.d;
+    }
+    if (!c.text.empty())
+    {
+        return atoll(c.text.data());
+    }
+    return c.i;
+}
+
+// ============================================================================
+// 12/15 getDouble
+// ============================================================================
+double PreparedQuery::getDouble(int col)
+{
+    if (isNull(col)) return 0.0;
+    Column& c = columns[col];
+
+    if (c.type == MYSQL_TYPE_DECIMAL || c.type == MYSQL_TYPE_NEWDECIMAL ||
+        c.type == MYSQL_TYPE_FLOAT || c.type == MYSQL_TYPE_DOUBLE)
+    {
+        return c.d;
+    }
+    if (!c.text.empty())
+    {
+        return atof(c.text.data());
+    }
+    return (double)c.i;
+}
+
+// ============================================================================
+// 13/15 getString
+// ============================================================================
+string PreparedQuery::getString(int col)
+{
+    if (isNull(col)) return "";
+    Column& c = columns[col];
+    char buf[64];
+
+    switch (c.type)
+    {
+        case MYSQL_TYPE_TINY:
+        case MYSQL_TYPE_SHORT:
+        case MYSQL_TYPE_INT24:
+        case MYSQL_TYPE_LONG:
+        case MYSQL_TYPE_LONGLONG:
+        case MYSQL_TYPE_YEAR:
+            return to_string(c.i);
+
+        case MYSQL_TYPE_DECIMAL:
+        case MYSQL_TYPE_NEWDECIMAL:
+        case MYSQL_TYPE_FLOAT:
+        case MYSQL_TYPE_DOUBLE:
+            // Keep the column scale so DECIMAL(10,2) still prints as "35.00"
+            if (c.decimals < 31) snprintf(buf, sizeof(buf), "%.*f", (int)c.decimals, c.d);
+            else snprintf(buf, sizeof(buf), "%g", c.d);
+            return buf;
+
+        case MYSQL_TYPE_DATE:
+            snprintf(buf, sizeof(buf), "%04u-%02u-%02u", c.t.year, c.t.month, c.t.day);
+            return buf;
+
+        case MYSQL_TYPE_TIME:
+            snprintf(buf, sizeof(buf), "%02u:%02u:%02u", c.t.hour, c.t.minute, c.t.second);
+            return buf;
+
+        case MYSQL_TYPE_DATETIME:
+        case MYSQL_TYPE_TIMESTAMP:
+            snprintf(buf, sizeof(buf), "%04u-%02u-%02u %02u:%02u:%02u",
+                     c.t.year, c.t.month, c.t.day, c.t.hour, c.t.minute, c.t.second);
+            return buf;
+
+        default:
+            return string(c.text.data(), c.length < c.text.size() ? c.length : c.text.size() - 1);
+    }
+}
+// ============================================================================
+// 14/15 paramLiterals
+// ============================================================================
+vector<string> PreparedQuery::paramLiterals()
+{
+    // Render bound values as SQL literals so the slow log can EXPLAIN them
+    vector<string> out;
+    char buf[64];
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        // #### Secret Check ####
+        // Still a string literal, so the plan can be captured without the value
+        if (values[i].secret)
+        {
+            out.push_back("'***'");
+            continue;
+        }
+
+        switch (params[i].buffer_type)
+        {
+            case MYSQL_TYPE_LONGLONG:
+                out.push_back(to_string(values[i].i));
+                break;
+
+            case MYSQL_TYPE_DOUBLE:
+                snprintf(buf, sizeof(buf), "%.17g", values[i].d);
+                out.push_back(buf);
+                break;
+
+            case MYSQL_TYPE_STRING:
+            {
+                const string& s = values[i].s;
+                vector<char> escaped(s.length() * 2 + 1);
+                unsigned long n = mysql_real_escape_string(conn, escaped.data(), s.c_str(), s.length());
+                out.push_back("'" + string(escaped.data(), n) + "'");
+                break;
+            }
+
+            default:
+                out.push_back("NULL");
+                break;
+        }
+    }
+    return out;
+}
+
+// ============================================================================
+// 15/15 logIfSlow
+// ============================================================================
+void PreparedQuery::logIfSlow(uint64_t micros)
+{
+    if (SlowQueryLog::isSlow(micros))
+    {
+        SlowQueryLog::capture(site, sql, paramLiterals(), micros);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+// ============================================================================
+// STATEMENT CACHE HEADER
+// ============================================================================
+#ifndef STATEMENT_CACHE_H
+#define STATEMENT_CACHE_H
+
+// External Libraries
+#include <mysql.h>      // MySQL C API (prepared statement interface)
+#include <string>       // SQL templates and string results
+#include <vector>       // Bind buffers
+#include <cstdint>      // Byte counters
+
+using namespace std;
+
+// ============================================================================
+// StatementCache
+// Prepared statements keyed by SQL template, one set per connection.
+// Statements live until the connection is released back to the server.
+// ============================================================================
+class StatementCache
+{
+public:
+    static MYSQL_STMT* get(MYSQL* conn, const string& sql);
+    static void release(MYSQL* conn);
+    static unsigned long epoch(MYSQL* conn);
+};
+
+// ============================================================================
+// PreparedQuery
+// One execution of a cached statement. Parameters use '?' placeholders and
+// results come back through binary-protocol binding (no text re-parsing).
+// Only one PreparedQuery per SQL template may be open on a connection.
+// ============================================================================
+class PreparedQuery
+{
+public:
+    // ============================================================================
+    // Constructor / Destructor
+    // ============================================================================
+    PreparedQuery(MYSQL* c, const string& sqlTemplate, const char* callSite = "PreparedQuery");
+    ~PreparedQuery();
+
+    // ============================================================================
+    // Parameter Binding (0-based, in placeholder order)
+    // ============================================================================
+    void bindInt(int idx, long long value);
+    void bindDouble(int idx, double value);
+    void bindString(int idx, const string& value);
+    void bindSecret(int idx, const string& value);   // bindString, shown as '***' in the slow-query log
+
+    // ============================================================================
+    // Execution
+    // ============================================================================
+    bool execute();
+    bool fetch();
+    my_ulonglong affectedRows();
+    my_ulonglong rowCount();
+    string error();
+    bool transient();        // Deadlock, lock wait timeout or lost session
+    void markIdempotent();   // Safe to re-run after a reconnect (reads)
+
+    // ============================================================================
+    // Column Access (current row)
+    // ============================================================================
+    bool isNull(int col);
+    long long getInt(int col);
+    double getDouble(int col);
+    string getString(int col);
+
+private:
+    struct Param
+    {
+        long long i;          // Integer value
+        double d;             // Floating value
+        string s;             // Text value
+        unsigned long length; // Text length
+        bool secret;          // Redacted in paramLiterals
+    };
+
+    struct Column
+    {
+        enum_field_types type;  // Source column type
+        unsigned int decimals;  // Scale for DECIMAL formatting
+        long long i;            // Integer buffer
+        double d;               // Floating / decimal buffer
+        MYSQL_TIME t;           // Date / time buffer
+        vector<char> text;      // Text buffer (sized from max_length)
+        unsigned long length;   // Actual length fetched
+        my_bool nullFlag;       // NULL indicator
+        my_bool errorFlag;      // Truncation indicator
+    };
+
+    MYSQL* conn;                // Connection the statement belongs to
+    string sql;                 // Template text (slow-query log)
+    MYSQL_STMT* stmt;           // Cached statement (owned by StatementCache)
+    unsigned long stmtEpoch;    // Cache epoch stmt was taken from
+    vector<MYSQL_BIND> params;  // Parameter binds
+    vector<Param> values;       // Parameter storage
+    vector<MYSQL_BIND> results; // Result binds
+    vector<Column> columns;     // Result storage
+    bool hasResult;             // Statement produced a result set
+    const char* site;           // Call-site name for QueryMetrics
+    uint64_t fetchedBytes;      // Bytes read through fetch()
+    bool idempotent;            // Retried once after a lost connection
+    bool lostConnection;        // Last execute was cut off by a reconnect
+
+    bool bindResults();
+    bool stale();
+    vector<string> paramLiterals();
+    void logIfSlow(uint64_t micros);
+};
+
+#endif
\ No newline at end of file
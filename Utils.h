@@ -6,6 +6,8 @@
 #include <limits>
 #include <algorithm>
 #include <sstream>
+#include <cstdio>
+#include "Format.h"
 
 using namespace std;
 
@@ -133,6 +135,14 @@ namespace Utils {
         }
     }
 
+    // ============================================================================
+    // formatMoney
+    // Two-decimal text for a price, as DECIMAL(10,2) columns print.
+    // ============================================================================
+    static string formatMoney(double value) {
+        return Format::money(value);
+    }
+
     // ============================================================================
     // getValidYesNo
     // Returns 1 for Yes, 0 for No. Accepts 1, 0, y, n, Y, N.
@@ -16,11 +16,18 @@
 #include "IssueModule.h"        // Manages customer issues and refunds
 #include "ReportModule.h"       // Generates sales and financial reports
 #include "Utils.h"              // Shared Utility Functions
+#include "QueryMetrics.h"       // Per-call-site query latency
+#include "SlowQueryLog.h"       // Slow queries with EXPLAIN plans
+#include "MySqlStore.h"         // Repositories over a leased connection
+#include "MemoryStore.h"        // In-process repositories (--memory)
+#include "KernelBenchmark.h"    // Aggregation kernel timings (--bench-kernels)
+#include <cstring>              // Argument comparison
+#include <algorithm>            // Benchmark row clamp
 
 using namespace std;
 
 // ============================================================================
-// 2/5 printSuccess
+// 2/6 printSuccess
 // ============================================================================
 static void printSuccess(string msg)
 {
@@ -30,7 +37,7 @@ static void printSuccess(string msg)
 }
 
 // ============================================================================
-// 3/5 printError
+// 3/6 printError
 // ============================================================================
 static void printError(string msg)
 {
@@ -38,7 +45,7 @@ static void printError(string msg)
 }
 
 // ============================================================================
-// 4/5 showWelcomeScreen
+// 4/6 showWelcomeScreen
 // ============================================================================
 bool showWelcomeScreen()
 {
@@ -74,15 +81,43 @@ bool showWelcomeScreen()
 }
 
 // ============================================================================
-// 5/5 Main Loop
+// 5/6 runScreen
+// Runs one screen against the in-memory store when there is one, otherwise
+// against a MySqlStore over a connection leased for the screen's lifetime.
 // ============================================================================
-int main()
+template <typename Screen>
+static void runScreen(DatabaseConnection& db, DataStore* memory, Screen screen)
+{
+    if (memory)
+    {
+        screen(memory);
+        return;
+    }
+
+    DatabaseConnection::Handle h = db.acquire();
+    if (!h.get()) { printError("Database unavailable."); system("pause"); return; }
+    MySqlStore store(h.get(), &db);
+    screen(&store);
+}
+
+// ============================================================================
+// 6/6 Main Loop
+// ============================================================================
+int main(int argc, char* argv[])
 {
     // --------------------------------------------------
     // System Initialization
     // --------------------------------------------------
     SetConsoleOutputCP(65001); 
 
+    // --bench-kernels [millions] times the report kernels and exits without logging in
+    if (argc > 1 && strcmp(argv[1], "--bench-kernels") == 0)
+    {
+        int millions = (argc > 2) ? atoi(argv[2]) : 10;
+        KernelBenchmark::run(max(1, min(millions, 50)));
+        return 0;
+    }
+
     if (!showWelcomeScreen()) 
     {
         cout << "\n  Goodbye!\n";
@@ -90,18 +125,44 @@ int main()
     }
 
     // --------------------------------------------------
-    // Database Initialization
+    // Storage Initialization
     // --------------------------------------------------
-    DatabaseConnection db;
-    // #### Database Error Check ####
-    MYSQL* conn = db.connect();
-    
-    if (!conn) 
-    { 
-        return 1; 
+    // --memory runs without a MySQL server on a seeded in-process store
+    bool useMemory = (argc > 1 && strcmp(argv[1], "--memory") == 0);
+
+    // Pool of 2-6 connections: one held by the login session, the rest leased per screen
+    DatabaseConnection db(2, 6);
+    DatabaseConnection::Handle session;
+    MemoryStore memoryStore;
+    DataStore* memory = nullptr;
+    DataStore* loginStore = nullptr;
+    MySqlStore* sessionStore = nullptr;
+
+    if (useMemory)
+    {
+        memoryStore.seedDefaults();
+        memory = &memoryStore;
+        loginStore = &memoryStore;
     }
+    else
+    {
+        // #### Database Error Check ####
+        if (!db.connect()) 
+        { 
+            return 1; 
+        }
+        // Statements slower than 200 ms are logged with an EXPLAIN taken on a spare connection
+        SlowQueryLog::configure(&db, 200, "FAIX_Slow_Queries.log");
 
-    AdminModule admin(conn);
+        session = db.acquire();
+        if (!session.get()) 
+        { 
+            return 1; 
+        }
+        sessionStore = new MySqlStore(session.get(), &db);
+        loginStore = sessionStore;
+    }
+    AdminModule admin(loginStore);
 
     // --------------------------------------------------
     // Main Application Loop
@@ -133,6 +194,9 @@ int main()
         int choice;
         do
         {
+            // Keep warm connections alive between screens
+            db.pingIdle();
+
             // --------------------------------------------------
             // Main Dashboard Menu
             // --------------------------------------------------
@@ -151,6 +215,7 @@ int main()
             cout << "    2) Place New Order\n";
             cout << "    3) Track / Update Order\n";
             cout << "    4) Order Issues & Refunds\n";
+            cout << "    7) Bulk Order Import (CSV / JSONL)\n";
             cout << "\n   [ ADMINISTRATION ]\n";
             cout << "   ──────────────────────────────────────────────────────\n";
             
@@ -171,7 +236,7 @@ int main()
             cout << "  ────────────────────────────────────────────────────────\n";
             cout << "   Choice ➜ ";
             
-            choice = Utils::getValidRange(0, 6);
+            choice = Utils::getValidRange(0, 7);
 
             // --------------------------------------------------
             // Menu Logic
@@ -180,26 +245,22 @@ int main()
             {
                 case 1: 
                 { 
-                    InventoryModule inv(conn); 
-                    inv.manageInventory(); 
+                    runScreen(db, memory, [](DataStore* s) { InventoryModule inv(s); inv.manageInventory(); });
                     break; 
                 }
                 case 2: 
                 { 
-                    OrderModule ord(conn); 
-                    ord.placeOrder(); 
+                    runScreen(db, memory, [](DataStore* s) { OrderModule ord(s); ord.placeOrder(); });
                     break; 
                 }
                 case 3: 
                 { 
-                    OrderModule ord(conn); 
-                    ord.trackOrder(); 
+                    runScreen(db, memory, [](DataStore* s) { OrderModule ord(s); ord.trackOrder(); });
                     break; 
                 }
                 case 4: 
                 { 
-                    IssueModule iss(conn); 
-                    iss.manageIssues(); 
+                    runScreen(db, memory, [](DataStore* s) { IssueModule iss(s); iss.manageIssues(); });
                     break; 
                 }
                 case 5: 
@@ -207,8 +268,7 @@ int main()
                     // #### Role Authorization Check ####
                     if (userRole == "Manager") 
                     { 
-                        ReportModule rep(conn); 
-                        rep.generateReport(); 
+                        runScreen(db, memory, [](DataStore* s) { ReportModule rep(s); rep.generateReport(); });
                     }
                     else 
                     { 
@@ -231,9 +291,16 @@ int main()
                     }
                     break; 
                 }
+                case 7: 
+                { 
+                    runScreen(db, memory, [](DataStore* s) { OrderModule ord(s); ord.importOrders(); });
+                    break; 
+                }
                 case 0: 
                 {
                     cout << "  Logging out...\n"; 
+                    // Persist this session's query latency histograms
+                    QueryMetrics::dumpToFile("FAIX_Query_Metrics.log");
                     break;
                 }
                 default: 
@@ -246,5 +313,6 @@ int main()
         } while (choice != 0); 
     } 
 
+    delete sessionStore;
     return 0;
 }
\ No newline at end of file
@@ -11,6 +11,10 @@ USE `souvenir_system`;
 -- ----------------------------------------------------------------
 SET FOREIGN_KEY_CHECKS = 0;
 DROP TABLE IF EXISTS `issues`;
+DROP TABLE IF EXISTS `order_sequences`;
+DROP TABLE IF EXISTS `daily_product_sales`;
+DROP TABLE IF EXISTS `order_changes`;
+DROP TABLE IF EXISTS `change_readers`;
 DROP TABLE IF EXISTS `orders`;
 DROP TABLE IF EXISTS `products`;
 DROP TABLE IF EXISTS `admins`;
@@ -57,6 +61,8 @@ CREATE TABLE `orders` (
   PRIMARY KEY (`id`),
   UNIQUE KEY `smart_id` (`smart_id`),
   KEY `product_id` (`product_id`),
+  KEY `order_date` (`order_date`),
+  KEY `status_order_date` (`status`, `order_date`),
   CONSTRAINT `orders_ibfk_1` FOREIGN KEY (`product_id`) REFERENCES `products` (`id`)
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
 
@@ -72,6 +78,44 @@ CREATE TABLE `issues` (
   CONSTRAINT `issues_ibfk_1` FOREIGN KEY (`order_id`) REFERENCES `orders` (`id`)
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
 
+-- Table: order_sequences (last smart_id sequence handed out per day)
+CREATE TABLE `order_sequences` (
+  `seq_date` date NOT NULL,
+  `last_seq` int(11) NOT NULL,
+  PRIMARY KEY (`seq_date`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
+
+-- Table: daily_product_sales (orders summed per day, product and status; kept by the triggers in section 8)
+CREATE TABLE `daily_product_sales` (
+  `sale_date` date NOT NULL,
+  `product_id` int(11) NOT NULL,
+  `status` varchar(20) NOT NULL,
+  `qty` bigint(20) NOT NULL DEFAULT 0,
+  `revenue` decimal(14,2) NOT NULL DEFAULT 0.00,
+  `order_count` int(11) NOT NULL DEFAULT 0,
+  PRIMARY KEY (`sale_date`, `product_id`, `status`),
+  KEY `status_sale_date` (`status`, `sale_date`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
+
+-- Table: order_changes (change feed for the report snapshot and search index; version is their watermark, filled by the triggers in section 8;
+-- changed_at bounds the window readers re-read for versions committed out of order)
+CREATE TABLE `order_changes` (
+  `version` bigint(20) NOT NULL AUTO_INCREMENT,
+  `order_id` int(11) NOT NULL,
+  `changed_at` datetime NOT NULL DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY (`version`),
+  KEY `order_id` (`order_id`),
+  KEY `changed_at` (`changed_at`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
+
+-- Table: change_readers (version each running feed reader has read to and when that read started; order_changes is pruned only below the slowest)
+CREATE TABLE `change_readers` (
+  `reader` varchar(64) NOT NULL,
+  `version` bigint(20) NOT NULL,
+  `seen_at` datetime NOT NULL,
+  PRIMARY KEY (`reader`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
+
 -- 4. INSERT BASE DATA
 -- ----------------------------------------------------------------
 
@@ -177,3 +221,57 @@ UPDATE products SET stock_quantity = 5 WHERE id = 2;
 UPDATE products SET stock_quantity = 20 WHERE id = 3;
 UPDATE products SET stock_quantity = 0 WHERE id = 4;
 UPDATE products SET stock_quantity = 0 WHERE id = 5;
+
+-- 7. SEED ORDER SEQUENCES (Continue numbering after the generated history)
+-- ----------------------------------------------------------------
+INSERT INTO `order_sequences` (`seq_date`, `last_seq`)
+SELECT DATE(`order_date`), COUNT(*) FROM `orders` GROUP BY DATE(`order_date`);
+
+-- 8. DAILY SALES ROLLUP + CHANGE FEED (Triggers keep both in step with every order write)
+-- ----------------------------------------------------------------
+DROP TRIGGER IF EXISTS `orders_rollup_insert`;
+DROP TRIGGER IF EXISTS `orders_rollup_update`;
+DROP TRIGGER IF EXISTS `orders_rollup_delete`;
+
+DELIMITER $$
+CREATE TRIGGER `orders_rollup_insert` AFTER INSERT ON `orders` FOR EACH ROW
+BEGIN
+    INSERT INTO `daily_product_sales` (`sale_date`, `product_id`, `status`, `qty`, `revenue`, `order_count`)
+    VALUES (DATE(NEW.order_date), NEW.product_id, IFNULL(NEW.status, ''), NEW.quantity, NEW.total_price, 1)
+    ON DUPLICATE KEY UPDATE `qty` = `qty` + VALUES(`qty`), `revenue` = `revenue` + VALUES(`revenue`), `order_count` = `order_count` + 1;
+    INSERT INTO `order_changes` (`order_id`) VALUES (NEW.id);
+END$$
+
+CREATE TRIGGER `orders_rollup_update` AFTER UPDATE ON `orders` FOR EACH ROW
+BEGIN
+    -- Only the rolled-up columns matter; address or spec edits leave the rollup alone
+    IF NOT (OLD.status <=> NEW.status) OR OLD.product_id <> NEW.product_id OR OLD.quantity <> NEW.quantity
+       OR OLD.total_price <> NEW.total_price OR DATE(OLD.order_date) <> DATE(NEW.order_date) THEN
+        UPDATE `daily_product_sales`
+        SET `qty` = `qty` - OLD.quantity, `revenue` = `revenue` - OLD.total_price, `order_count` = `order_count` - 1
+        WHERE `sale_date` = DATE(OLD.order_date) AND `product_id` = OLD.product_id AND `status` = IFNULL(OLD.status, '');
+        DELETE FROM `daily_product_sales`
+        WHERE `sale_date` = DATE(OLD.order_date) AND `product_id` = OLD.product_id AND `status` = IFNULL(OLD.status, '') AND `order_count` <= 0;
+
+        INSERT INTO `daily_product_sales` (`sale_date`, `product_id`, `status`, `qty`, `revenue`, `order_count`)
+        VALUES (DATE(NEW.order_date), NEW.product_id, IFNULL(NEW.status, ''), NEW.quantity, NEW.total_price, 1)
+        ON DUPLICATE KEY UPDATE `qty` = `qty` + VALUES(`qty`), `revenue` = `revenue` + VALUES(`revenue`), `order_count` = `order_count` + 1;
+        INSERT INTO `order_changes` (`order_id`) VALUES (NEW.id);
+    END IF;
+END$$
+
+CREATE TRIGGER `orders_rollup_delete` AFTER DELETE ON `orders` FOR EACH ROW
+BEGIN
+    UPDATE `daily_product_sales`
+    SET `qty` = `qty` - OLD.quantity, `revenue` = `revenue` - OLD.total_price, `order_count` = `order_count` - 1
+    WHERE `sale_date` = DATE(OLD.order_date) AND `product_id` = OLD.product_id AND `status` = IFNULL(OLD.status, '');
+    DELETE FROM `daily_product_sales`
+    WHERE `sale_date` = DATE(OLD.order_date) AND `product_id` = OLD.product_id AND `status` = IFNULL(OLD.status, '') AND `order_count` <= 0;
+    INSERT INTO `order_changes` (`order_id`) VALUES (OLD.id);
+END$$
+DELIMITER ;
+
+-- Backfill the generated history (later rebuilds: Reports > Rebuild / Verify Sales Rollup)
+INSERT INTO `daily_product_sales` (`sale_date`, `product_id`, `status`, `qty`, `revenue`, `order_count`)
+SELECT DATE(`order_date`), `product_id`, IFNULL(`status`, ''), SUM(`quantity`), SUM(`total_price`), COUNT(*)
+FROM `orders` GROUP BY DATE(`order_date`), `product_id`, IFNULL(`status`, '');